@@ -1,5 +1,7 @@
 #include <map.hpp>
 
+#include <logger/logger.hpp>
+
 #include <external/imgui-SFML.hpp>
 
 #include <SFML/Graphics.hpp>
@@ -68,5 +70,7 @@ auto main() noexcept -> int
 	}
 
 	ImGui::SFML::Shutdown();
+
+	logger::Logger::stop();
 	return 0;
 }
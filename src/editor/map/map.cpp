@@ -2,11 +2,14 @@
 
 #include <algorithm>
 #include <functional>
+#include <mutex>
 #include <ranges>
 
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/base_sink.h>
 
+#include <logger/logger.hpp>
+
 #include <SFML/Graphics.hpp>
 
 #include <external/imgui-SFML.hpp>
@@ -67,6 +70,57 @@ namespace
 		}
 	};
 
+	// 游戏日志由后台线程写入,在UI线程中转发至ConsoleSink
+	class LoggerBridge
+	{
+	public:
+		struct message_type
+		{
+			logger::Level level;
+			std::string message;
+		};
+
+	private:
+		inline static std::mutex mutex_{};
+		inline static std::vector<message_type> pending_{};
+
+	public:
+		static auto push(const logger::Level level, const std::string_view message) noexcept -> void
+		{
+			std::scoped_lock lock{mutex_};
+			pending_.emplace_back(level, std::string{message});
+		}
+
+		static auto forward() noexcept -> void
+		{
+			std::vector<message_type> messages;
+			{
+				std::scoped_lock lock{mutex_};
+				messages.swap(pending_);
+			}
+
+			for (const auto& [level, message]: messages)
+			{
+				const auto spdlog_level = [level]() noexcept -> spdlog::level::level_enum
+				{
+					switch (level)
+					{
+						case logger::Level::TRACE: { return spdlog::level::trace; }
+						case logger::Level::DEBUG: { return spdlog::level::debug; }
+						case logger::Level::INFO: { return spdlog::level::info; }
+						case logger::Level::WARNING: { return spdlog::level::warn; }
+						case logger::Level::ERR: { return spdlog::level::err; }
+						case logger::Level::OFF: { return spdlog::level::off; }
+					}
+
+					return spdlog::level::info;
+				}();
+
+				spdlog::log(spdlog_level, "{}", message);
+			}
+		}
+	};
+
 	auto expand_string_buffer(ImGuiInputTextCallbackData* callback_data) noexcept -> int
 	{
 		if (callback_data and callback_data->EventFlag & ImGuiInputTextFlags_CallbackResize)
@@ -760,6 +814,8 @@ namespace editor
 	{
 		std::ignore = this;
 
+		LoggerBridge::forward();
+
 		ImGui::Begin(window_name_console.data());
 		{
 			static bool show_errors = true;
@@ -919,6 +975,9 @@ namespace editor
 			logger->set_pattern("[%H:%M:%S] %v");
 
 			spdlog::set_default_logger(logger);
+
+			::logger::Logger::add_sink(&LoggerBridge::push);
+			::logger::Logger::start({}, false);
 		}
 
 		// 创建 20x20 的瓦片地图,每个瓦片大小为32x32像素
@@ -0,0 +1,1120 @@
+#include <bench.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <print>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <graphics/atlas.hpp>
+#include <graphics/skyline_packer.hpp>
+#include <graphics/sprite_batch.hpp>
+#include <graphics/health_bar.hpp>
+
+#include <loaders/catalogue.hpp>
+#include <loaders/config.hpp>
+#include <loaders/pack.hpp>
+
+#include <map/map_file.hpp>
+
+#include <utility/random.hpp>
+#include <utility/thread_pool.hpp>
+
+#include <components/core/tags.hpp>
+#include <components/core/transform.hpp>
+#include <components/core/camera.hpp>
+#include <components/combat/unit.hpp>
+#include <components/combat/enemy.hpp>
+#include <components/combat/health_bar.hpp>
+#include <components/combat/weapon.hpp>
+#include <components/game/game.hpp>
+#include <components/game/player.hpp>
+#include <components/map/map.hpp>
+
+#include <factory/enemy.hpp>
+#include <factory/tower.hpp>
+
+#include <helper/player.hpp>
+#include <helper/wave.hpp>
+#include <helper/snapshot.hpp>
+#include <helper/health_bar.hpp>
+#include <helper/observer.hpp>
+
+#include <update/simulation.hpp>
+#include <update/weapon.hpp>
+
+#include <runner.hpp>
+
+#include <entt/entt.hpp>
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	[[nodiscard]] auto milliseconds_of(const clock_type::duration duration) noexcept -> double
+	{
+		return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+	}
+
+	// 多次执行取平均值
+	template<typename Function>
+	[[nodiscard]] auto measure(const std::uint32_t times, Function&& function) noexcept -> double
+	{
+		const auto start = clock_type::now();
+		for (std::uint32_t i = 0; i < times; ++i)
+		{
+			function();
+		}
+
+		return milliseconds_of(clock_type::now() - start) / times;
+	}
+
+	// 武器开火次数(不造成伤害,保证目标数量不变)
+	std::uint64_t weapon_shot_count = 0;
+
+	auto count_shot(entt::registry& registry, const entt::entity attacker, const entt::entity victim) noexcept -> void
+	{
+		std::ignore = registry;
+		std::ignore = attacker;
+		std::ignore = victim;
+
+		weapon_shot_count += 1;
+	}
+
+	// 冷却调度之前的实现: 冷却中的武器持有该组件,每个模拟步遍历递减,冷却结束时移除,开火时再添加
+	class ChurnCooldown
+	{
+	public:
+		float delay;
+	};
+
+	auto weapon_churn(entt::registry& registry, const sf::Time delta) noexcept -> void
+	{
+		using namespace components;
+
+		const auto delta_time = delta.asSeconds();
+
+		for (const auto tower_view = registry.view<ChurnCooldown>();
+		     auto [entity, cooldown]: tower_view.each())
+		{
+			cooldown.delay -= delta_time;
+
+			if (cooldown.delay > 0)
+			{
+				continue;
+			}
+
+			registry.remove<ChurnCooldown>(entity);
+		}
+
+		for (const auto tower_view = registry.view<const weapon::Range, const transform::Position>(entt::exclude<ChurnCooldown>);
+		     const auto [entity, range, position]: tower_view.each())
+		{
+			if (const auto target = helper::Observer::find_tower_target(registry, entity, position.position, range.range);
+				target != entt::null)
+			{
+				registry.emplace_or_replace<weapon::Target>(entity, target);
+			}
+			else
+			{
+				registry.remove<weapon::Target>(entity);
+			}
+		}
+
+		for (const auto tower_view = registry.view<const weapon::Target, const weapon::FireRate, const weapon::Trigger>(entt::exclude<ChurnCooldown>);
+		     const auto [entity, target, fire_rate, trigger]: tower_view.each())
+		{
+			registry.emplace<ChurnCooldown>(entity, fire_rate.fire_rate);
+
+			trigger.on_fire(registry, entity, target.entity);
+		}
+	}
+
+	[[nodiscard]] auto random_sprites(const std::uint32_t count, const std::uint32_t texture_count) noexcept -> std::vector<graphics::SpriteBatch::Sprite>
+	{
+		std::vector<graphics::SpriteBatch::Sprite> sprites;
+		sprites.reserve(count);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			utility::Random random{0, i};
+
+			sprites.push_back(
+				{
+						.texture = random.integer(0, texture_count - 1),
+						.position = {random.real(0, 1280), random.real(0, 960)},
+						.scale = {2.f, 2.f},
+						.rotation = sf::degrees(random.real(0, 360)),
+						.origin = {8.f, 8.f},
+						.area = {{static_cast<int>(random.integer(0, 3)) * 16, 0}, {16, 16}},
+						.color = sf::Color::White
+				}
+			);
+		}
+
+		return sprites;
+	}
+
+	auto write_catalogue(const std::filesystem::path& path, const std::uint32_t count) noexcept -> void
+	{
+		auto enemies = nlohmann::json::array();
+		auto towers = nlohmann::json::array();
+
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			enemies.push_back(
+				{
+						{"type", i},
+						{"name", std::format("Enemy{}", i)},
+						{"texture", "deep-dive-AntleredRascal"},
+						{"scale", 2.0},
+						{"frame", {{"width", 16}, {"height", 16}, {"count", 4}, {"duration", 0.25}, {"looping", true}}},
+						{"archetype", "GROUND"},
+						{"health", 100 + i % 100},
+						{"speed", 30},
+						{"speed_variance", 20},
+						{"power", 1},
+						{"power_variance", 100},
+				}
+			);
+
+			towers.push_back(
+				{
+						{"type", 0x2000 + i},
+						{"name", std::format("Tower{}", i)},
+						{"texture", "deep-dive-WarpSkull"},
+						{"scale", 2.5},
+						{"frame", {{"width", 16}, {"height", 16}, {"count", 4}, {"duration", 0.5}, {"looping", true}}},
+						{"range", 50},
+						{"fire_rate", 1.5},
+						{"targeting", "GROUND"},
+				}
+			);
+		}
+
+		std::ofstream file{path};
+		file << nlohmann::json{{"enemies", std::move(enemies)}, {"towers", std::move(towers)}}.dump();
+	}
+
+	auto write_config(const std::filesystem::path& path, const std::uint32_t count) noexcept -> void
+	{
+		auto config = nlohmann::json::object();
+
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			config[std::format("section{}", i)] =
+			{
+					{"value", i},
+					{"name", std::format("Section{}", i)},
+					{"values", {i, i + 1, i + 2, i + 3}},
+			};
+		}
+
+		std::ofstream file{path};
+		file << config.dump();
+	}
+
+	// 生成count个资源文件(分布在若干子目录中,大小为1~64KB),返回相对路径
+	[[nodiscard]] auto write_media(const std::filesystem::path& directory, const std::uint32_t count) noexcept -> std::vector<std::string>
+	{
+		constexpr std::array sub_directories{"map", "enemy", "tower", "sound"};
+
+		std::error_code error_code;
+		for (const auto* sub_directory: sub_directories)
+		{
+			std::filesystem::create_directories(directory / sub_directory, error_code);
+		}
+
+		std::vector<std::string> names;
+		names.reserve(count);
+
+		std::vector<char> buffer;
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			auto& name = names.emplace_back(std::format("{}/asset{}.bin", sub_directories[i % sub_directories.size()], i));
+
+			buffer.resize((1 + i * 7919 % 64) * 1024);
+			std::ranges::fill(buffer, static_cast<char>(i));
+
+			std::ofstream file{directory / name, std::ios::binary | std::ios::trunc};
+			file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		}
+
+		return names;
+	}
+
+	// 随机地图(大部分是可建造地面)
+	[[nodiscard]] auto random_map(const std::uint32_t count) noexcept -> map::MapFile::Data
+	{
+		map::MapFile::Data data
+		{
+				.tile_map = {32, 32, count, count},
+				.start_gates = {{0, 0}},
+				.end_gates = {{count - 1, count - 1}},
+		};
+
+		for (std::uint32_t y = 0; y < count; ++y)
+		{
+			utility::Random random{2, y};
+
+			for (std::uint32_t x = 0; x < count; ++x)
+			{
+				const auto value = random.integer(0, 99);
+				const auto tile = value < 80 ? map::TileType::BUILDABLE_FLOOR : value < 95 ? map::TileType::OBSTACLE : map::TileType::BUILDABLE_OBSTACLE;
+
+				data.tile_map.set(x, y, tile);
+			}
+		}
+
+		return data;
+	}
+}
+
+namespace headless
+{
+	auto bench_catalogue(const std::uint32_t count) noexcept -> int
+	{
+		using components::combat::Type;
+
+		constexpr std::uint32_t times = 20;
+
+		std::error_code error_code;
+		const auto directory = std::filesystem::temp_directory_path(error_code) / "td_bench";
+		std::filesystem::create_directories(directory, error_code);
+
+		const auto json = directory / "catalogue.json";
+		const auto binary = directory / "catalogue.bin";
+
+		write_catalogue(json, count);
+
+		// 启动时直接解析JSON
+		const auto parse_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				std::ifstream file{json};
+				const auto config = nlohmann::json::parse(file, nullptr, false);
+				std::ignore = config.size();
+			}
+		);
+
+		// 编译(JSON修改后执行一次)
+		const auto compile_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				std::ignore = loaders::Catalogue::compile(json, binary);
+			}
+		);
+
+		// 启动时映射二进制目录
+		const auto load_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				const auto catalogue = loaders::Catalogue::load(binary);
+				std::ignore = catalogue.has_value();
+			}
+		);
+
+		const auto catalogue = loaders::Catalogue::load(binary);
+		if (not catalogue.has_value())
+		{
+			std::println(stderr, "无法载入目录: {}", binary.string());
+			return 1;
+		}
+
+		// 查找所有类型
+		std::uint64_t found = 0;
+		const auto lookup_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				for (std::uint32_t i = 0; i < count; ++i)
+				{
+					found += catalogue->enemy_of(static_cast<Type>(i)) != nullptr;
+					found += catalogue->tower_of(static_cast<Type>(0x2000 + i)) != nullptr;
+				}
+			}
+		);
+
+		const auto json_size = std::filesystem::file_size(json, error_code);
+		const auto binary_size = std::filesystem::file_size(binary, error_code);
+
+		std::println("catalogue: {} enemies + {} towers", catalogue->enemies().size(), catalogue->towers().size());
+		std::println("size: json {} bytes / binary {} bytes", json_size, binary_size);
+		std::println("{:<16} {:>12}", "stage", "avg(ms)");
+		std::println("{:<16} {:>12.3f}", "parse json", parse_ms);
+		std::println("{:<16} {:>12.3f}", "compile", compile_ms);
+		std::println("{:<16} {:>12.3f}", "load binary", load_ms);
+		std::println("{:<16} {:>12.3f} ({} found)", "lookup all", lookup_ms, found / times);
+
+		std::filesystem::remove_all(directory, error_code);
+		return 0;
+	}
+
+	auto bench_config(const std::uint32_t count) noexcept -> int
+	{
+		std::error_code error_code;
+		const auto directory = std::filesystem::temp_directory_path(error_code) / "td_bench";
+		std::filesystem::create_directories(directory, error_code);
+
+		const auto json = directory / "config.json";
+		auto cbor = json;
+		cbor.replace_extension(".cbor");
+
+		write_config(json, count);
+
+		std::vector<std::string> sections;
+		sections.reserve(count);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			sections.push_back(std::format("section{}", i));
+		}
+
+		// 之前的查询方式: 每次查询都解析整个文件并复制结果
+		std::uint64_t found_before = 0;
+		const auto before_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				for (const auto& section: sections)
+				{
+					std::ifstream file{json};
+					const auto config = nlohmann::json::parse(file, nullptr, false);
+
+					if (const auto it = config.find(section);
+						it != config.end())
+					{
+						const auto result = std::make_shared<nlohmann::json>(*it);
+						found_before += result->contains("value");
+					}
+				}
+			}
+		);
+
+		// 首次查询(解析JSON并写出CBOR缓存)
+		loaders::Config::clear();
+		std::filesystem::remove(cbor, error_code);
+		const auto cold_json_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				const std::string_view name{sections.front()};
+				std::ignore = loaders::Config::load(json, {&name, 1});
+			}
+		);
+
+		// 首次查询(载入CBOR缓存)
+		loaders::Config::clear();
+		const auto cold_cbor_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				const std::string_view name{sections.front()};
+				std::ignore = loaders::Config::load(json, {&name, 1});
+			}
+		);
+
+		// 使用文档缓存
+		std::uint64_t found_after = 0;
+		const auto after_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				for (const auto& section: sections)
+				{
+					const std::string_view name{section};
+					if (const auto result = loaders::Config::load(json, {&name, 1});
+						result != nullptr)
+					{
+						found_after += result->contains("value");
+					}
+				}
+			}
+		);
+		loaders::Config::clear();
+
+		if (found_before != found_after)
+		{
+			std::println(stderr, "查询结果不一致: {} / {}", found_before, found_after);
+			return 1;
+		}
+
+		const auto json_size = std::filesystem::file_size(json, error_code);
+		const auto cbor_size = std::filesystem::file_size(cbor, error_code);
+
+		std::println("config: {} entries, {} lookups", count, sections.size());
+		std::println("size: json {} bytes / cbor {} bytes", json_size, cbor_size);
+		std::println("{:<20} {:>12}", "stage", "total(ms)");
+		std::println("{:<20} {:>12.3f}", "parse per lookup", before_ms);
+		std::println("{:<20} {:>12.3f}", "cold (json)", cold_json_ms);
+		std::println("{:<20} {:>12.3f}", "cold (cbor)", cold_cbor_ms);
+		std::println("{:<20} {:>12.3f}", "cached lookups", after_ms);
+
+		std::filesystem::remove_all(directory, error_code);
+		return 0;
+	}
+
+	auto bench_map(const std::uint32_t count) noexcept -> int
+	{
+		constexpr std::uint32_t times = 10;
+
+		std::error_code error_code;
+		const auto directory = std::filesystem::temp_directory_path(error_code) / "td_bench";
+		std::filesystem::create_directories(directory, error_code);
+
+		const auto path = directory / "map.tdmap";
+
+		const auto source = random_map(count);
+
+		// 之前的载入方式: 按类型列出所有坐标,逐个设置
+		std::vector<std::pair<sf::Vector2u, map::TileType>> points;
+		for (std::uint32_t y = 0; y < count; ++y)
+		{
+			for (std::uint32_t x = 0; x < count; ++x)
+			{
+				if (const auto tile = source.tile_map.at(x, y);
+					tile != map::TileType::BUILDABLE_FLOOR)
+				{
+					points.emplace_back(sf::Vector2u{x, y}, tile);
+				}
+			}
+		}
+
+		const auto points_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				map::TileMap tile_map{32, 32, count, count};
+				std::ranges::fill(tile_map, map::TileType::BUILDABLE_FLOOR);
+
+				for (const auto [point, tile]: points)
+				{
+					tile_map.set(point.x, point.y, tile);
+				}
+			}
+		);
+
+		const auto write_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				std::ignore = map::MapFile::write(path, source.tile_map, source.start_gates, source.end_gates);
+			}
+		);
+
+		const auto read_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				const auto data = map::MapFile::read(path);
+				std::ignore = data.has_value();
+			}
+		);
+
+		const auto data = map::MapFile::read(path);
+		if (not data.has_value() or not std::ranges::equal(data->tile_map, source.tile_map))
+		{
+			std::println(stderr, "地图文件读写不一致: {}", path.string());
+			return 1;
+		}
+
+		const auto file_size = std::filesystem::file_size(path, error_code);
+
+		std::println("map: {}x{} ({} non-default tiles)", count, count, points.size());
+		std::println("size: {} bytes ({} bytes in memory)", file_size, static_cast<std::size_t>(count) * count * sizeof(map::TileType));
+		std::println("{:<16} {:>12}", "stage", "avg(ms)");
+		std::println("{:<16} {:>12.3f}", "set points", points_ms);
+		std::println("{:<16} {:>12.3f}", "write file", write_ms);
+		std::println("{:<16} {:>12.3f}", "read file", read_ms);
+
+		std::filesystem::remove_all(directory, error_code);
+		return 0;
+	}
+
+	auto bench_pack(const std::uint32_t count) noexcept -> int
+	{
+		constexpr std::size_t page_size = 4096;
+
+		std::error_code error_code;
+		const auto directory = std::filesystem::temp_directory_path(error_code) / "td_bench";
+		const auto media = directory / "media";
+		std::filesystem::create_directories(media, error_code);
+
+		const auto path = directory / "media.pack";
+
+		const auto names = write_media(media, count);
+
+		const auto build_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				std::ignore = loaders::Pack::build(media, path);
+			}
+		);
+
+		// 之前的载入方式: 逐个检查/打开/读取文件
+		std::uint64_t checksum_loose = 0;
+		const auto loose_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				std::vector<char> buffer;
+				for (const auto& name: names)
+				{
+					const auto file_path = media / name;
+					if (not std::filesystem::exists(file_path))
+					{
+						continue;
+					}
+
+					std::ifstream file{file_path, std::ios::binary};
+					buffer.resize(std::filesystem::file_size(file_path));
+					file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+					for (std::size_t i = 0; i < buffer.size(); i += page_size)
+					{
+						checksum_loose += static_cast<unsigned char>(buffer[i]);
+					}
+				}
+			}
+		);
+
+		// 映射资源包,直接读取映射的内存
+		std::uint64_t checksum_pack = 0;
+		const auto pack_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				const auto pack = loaders::Pack::open(path);
+				if (not pack.has_value())
+				{
+					return;
+				}
+
+				for (const auto& name: names)
+				{
+					const auto bytes = pack->find(name);
+					if (not bytes.has_value())
+					{
+						continue;
+					}
+
+					for (std::size_t i = 0; i < bytes->size(); i += page_size)
+					{
+						checksum_pack += std::to_integer<unsigned char>((*bytes)[i]);
+					}
+				}
+			}
+		);
+
+		if (checksum_loose != checksum_pack)
+		{
+			std::println(stderr, "资源包内容不一致: {} / {}", checksum_loose, checksum_pack);
+			return 1;
+		}
+
+		const auto pack_size = std::filesystem::file_size(path, error_code);
+
+		// 文件刚刚写入,两种方式都位于页缓存中,此处比较的是打开/查找文件的开销
+		std::println("pack: {} files, {} bytes", names.size(), pack_size);
+		std::println("{:<16} {:>12}", "stage", "total(ms)");
+		std::println("{:<16} {:>12.3f}", "build pack", build_ms);
+		std::println("{:<16} {:>12.3f}", "loose files", loose_ms);
+		std::println("{:<16} {:>12.3f}", "pack", pack_ms);
+
+		std::filesystem::remove_all(directory, error_code);
+		return 0;
+	}
+
+	auto bench_sprites(const std::uint32_t count) noexcept -> int
+	{
+		constexpr std::uint32_t frames = 200;
+		constexpr std::uint32_t texture_count = 3;
+
+		const auto sprites = random_sprites(count, texture_count);
+
+		graphics::SpriteBatch batch{};
+
+		const auto build_ms = measure(
+			frames,
+			[&]() noexcept -> void
+			{
+				batch.clear();
+				batch.reserve(sprites.size());
+				for (const auto& sprite: sprites)
+				{
+					batch.add(sprite);
+				}
+				batch.build();
+			}
+		);
+
+		std::println("sprites: {} ({} textures)", count, texture_count);
+		std::println("vertices: {} / draw calls: {} (unbatched: {})", batch.vertices().size(), batch.batches().size(), count);
+		std::println("{:<16} {:>12}", "stage", "avg(ms)");
+		std::println("{:<16} {:>12.3f}", "build batch", build_ms);
+
+		return 0;
+	}
+
+	auto bench_atlas(const std::uint32_t count) noexcept -> int
+	{
+		constexpr std::uint32_t frames = 200;
+		// 与media/enemy相同: 45个64x16的精灵表
+		constexpr std::uint32_t texture_count = 45;
+		constexpr sf::Vector2u texture_size{64, 16};
+		constexpr std::uint32_t page_size = 2048;
+		constexpr std::uint32_t padding = 2;
+
+		const auto sprites = random_sprites(count, texture_count);
+
+		std::vector<graphics::SkylinePacker> packers;
+		std::vector<graphics::Atlas::Page> pages;
+		std::vector<graphics::Atlas::Entry> entries;
+
+		const auto pack_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				for (std::uint32_t texture = 0; texture < texture_count; ++texture)
+				{
+					const sf::Vector2u padded_size{texture_size.x + padding, texture_size.y + padding};
+
+					std::optional<sf::Vector2u> position;
+					auto page = packers.size();
+					for (std::size_t i = 0; i < packers.size() and not position.has_value(); ++i)
+					{
+						position = packers[i].insert(padded_size);
+						page = i;
+					}
+					if (not position.has_value())
+					{
+						page = packers.size();
+						position = packers.emplace_back(sf::Vector2u{page_size, page_size}).insert(padded_size);
+						pages.push_back({.id = graphics::Atlas::page_id(page), .width = page_size, .height = page_size, .reserved = 0});
+					}
+
+					entries.push_back(
+						{
+								.texture = texture,
+								.page = graphics::Atlas::page_id(page),
+								.x = static_cast<std::int32_t>(position->x),
+								.y = static_cast<std::int32_t>(position->y),
+								.width = texture_size.x,
+								.height = texture_size.y
+						}
+					);
+				}
+			}
+		);
+
+		const graphics::Atlas atlas{std::move(pages), std::move(entries)};
+
+		graphics::SpriteBatch batch{};
+
+		const auto build = [&](const graphics::Atlas* using_atlas) noexcept -> double
+		{
+			batch.set_atlas(using_atlas);
+
+			return measure(
+				frames,
+				[&]() noexcept -> void
+				{
+					batch.clear();
+					batch.reserve(sprites.size());
+					for (const auto& sprite: sprites)
+					{
+						batch.add(sprite);
+					}
+					batch.build();
+				}
+			);
+		};
+
+		const auto separate_ms = build(nullptr);
+		const auto separate_batches = batch.batches().size();
+
+		const auto atlas_ms = build(&atlas);
+		const auto atlas_batches = batch.batches().size();
+
+		std::println("sprites: {} ({} textures -> {} atlas pages, {:.1f}% used)", count, texture_count, atlas.pages().size(), packers.front().occupancy() * 100.f);
+		std::println("pack: {:.3f}ms", pack_ms);
+		std::println("{:<16} {:>12} {:>12}", "stage", "avg(ms)", "draw calls");
+		std::println("{:<16} {:>12.3f} {:>12}", "textures", separate_ms, separate_batches);
+		std::println("{:<16} {:>12.3f} {:>12}", "atlas", atlas_ms, atlas_batches);
+
+		return 0;
+	}
+
+	auto bench_vertices(const std::uint32_t count) noexcept -> int
+	{
+		constexpr std::uint32_t frames = 50;
+		constexpr std::uint32_t texture_count = 3;
+		constexpr std::size_t health_bar_grain = 1024;
+
+		// 指定数量时只测试该数量
+		const auto counts = count == 0 ? std::vector<std::uint32_t>{10'000, 50'000, 100'000} : std::vector<std::uint32_t>{count};
+
+		std::println("workers: {}", utility::ThreadPool::global().worker_count());
+		std::println("{:<10} {:<12} {:>12} {:>12} {:>10} {:>14}", "count", "batch", "serial(ms)", "parallel(ms)", "speedup", "Mvertex/s");
+
+		for (const auto n: counts)
+		{
+			// 精灵
+			{
+				const auto sprites = random_sprites(n, texture_count);
+
+				graphics::SpriteBatch batch{};
+				const auto build = [&](const bool parallel) noexcept -> void
+				{
+					batch.clear();
+					batch.reserve(sprites.size());
+					for (const auto& sprite: sprites)
+					{
+						batch.add(sprite);
+					}
+					batch.build(parallel);
+				};
+
+				const auto serial_ms = measure(frames, [&]() noexcept -> void { build(false); });
+				const auto parallel_ms = measure(frames, [&]() noexcept -> void { build(true); });
+				const auto vertex_count = static_cast<double>(batch.vertices().size());
+
+				std::println(
+					"{:<10} {:<12} {:>12.3f} {:>12.3f} {:>9.2f}x {:>14.1f}",
+					n,
+					"sprite",
+					serial_ms,
+					parallel_ms,
+					serial_ms / parallel_ms,
+					vertex_count / parallel_ms / 1'000.
+				);
+			}
+
+			// 血条
+			{
+				std::vector<std::pair<sf::Vector2f, float>> bars;
+				bars.reserve(n);
+				for (std::uint32_t i = 0; i < n; ++i)
+				{
+					utility::Random random{1, i};
+					bars.emplace_back(sf::Vector2f{random.real(0, 1280), random.real(0, 960)}, random.unit());
+				}
+
+				std::vector<sf::Vertex> vertices(bars.size() * graphics::HealthBar::vertices_per_bar);
+				const auto fill = [&](const std::size_t begin, const std::size_t end) noexcept -> void
+				{
+					for (auto i = begin; i < end; ++i)
+					{
+						const auto [position, ratio] = bars[i];
+						graphics::HealthBar::generate(
+							position,
+							{16.f, 4.f},
+							ratio,
+							std::span{vertices}.subspan(i * graphics::HealthBar::vertices_per_bar).first<graphics::HealthBar::vertices_per_bar>()
+						);
+					}
+				};
+
+				const auto serial_ms = measure(frames, [&]() noexcept -> void { fill(0, bars.size()); });
+				const auto parallel_ms = measure(frames, [&]() noexcept -> void { utility::ThreadPool::global().parallel_for(bars.size(), health_bar_grain, fill); });
+				const auto vertex_count = static_cast<double>(vertices.size());
+
+				std::println(
+					"{:<10} {:<12} {:>12.3f} {:>12.3f} {:>9.2f}x {:>14.1f}",
+					n,
+					"health_bar",
+					serial_ms,
+					parallel_ms,
+					serial_ms / parallel_ms,
+					vertex_count / parallel_ms / 1'000.
+				);
+			}
+		}
+
+		return 0;
+	}
+
+	auto bench_weapon(const std::uint32_t count) noexcept -> int
+	{
+		using namespace components;
+
+		constexpr std::uint32_t steps = 600;
+		// 每秒20次
+		constexpr float fire_rate = .05f;
+		constexpr float range = 128.f;
+
+		Runner runner{};
+		auto& registry = runner.registry();
+
+		const auto& [start_gates] = registry.ctx().get<const map_ex::StartGate>();
+		if (start_gates.empty())
+		{
+			std::println(stderr, "地图没有出生点");
+			return 1;
+		}
+
+		// 塔与目标都位于出生点附近,每个塔在射程内都能找到目标
+		const auto gate_count = static_cast<std::uint32_t>(start_gates.size());
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			const auto tower = factory::tower(registry, start_gates[i % gate_count], static_cast<combat::Type>(0x2000));
+			if (tower == entt::null)
+			{
+				std::println(stderr, "建造塔失败");
+				return 1;
+			}
+
+			registry.replace<weapon::FireRate>(tower, fire_rate);
+			registry.replace<weapon::Range>(tower, range);
+			registry.replace<weapon::Trigger>(tower, &count_shot);
+		}
+
+		std::vector<entt::entity> enemies(count);
+		for (std::uint32_t gate = 0; gate < gate_count; ++gate)
+		{
+			const auto begin = static_cast<std::size_t>(count) * gate / gate_count;
+			const auto end = static_cast<std::size_t>(count) * (gate + 1) / gate_count;
+
+			factory::enemy(registry, gate, static_cast<combat::Type>(0x1000), std::span{enemies}.subspan(begin, end - begin));
+		}
+
+		// 敌人不移动,只需要建立一次索引
+		helper::Observer::rebuild(registry);
+
+		const auto run = [&](const auto system) noexcept -> std::pair<double, double>
+		{
+			auto& [elapsed] = registry.ctx().get<game::ElapsedSimulationTime>();
+
+			weapon_shot_count = 0;
+			registry.clear<weapon::Target>();
+
+			double total_us = 0;
+			double max_us = 0;
+			for (std::uint32_t step = 0; step < steps; ++step)
+			{
+				elapsed += update::simulation_step;
+
+				const auto start = clock_type::now();
+				system(registry, update::simulation_step);
+				const auto us = milliseconds_of(clock_type::now() - start) * 1'000.;
+
+				total_us += us;
+				max_us = std::ranges::max(max_us, us);
+			}
+
+			return {total_us / steps, max_us};
+		};
+
+		std::println("towers: {} / enemies: {} / steps: {}", count, count, steps);
+		std::println("{:<12} {:>12} {:>12} {:>10}", "weapon", "avg(us)", "max(us)", "shots");
+
+		const auto [churn_average, churn_max] = run(&weapon_churn);
+		const auto churn_shots = weapon_shot_count;
+		std::println("{:<12} {:>12.3f} {:>12.3f} {:>10}", "churn", churn_average, churn_max, churn_shots);
+
+		const auto [schedule_average, schedule_max] = run(&update::weapon);
+		const auto schedule_shots = weapon_shot_count;
+		std::println("{:<12} {:>12.3f} {:>12.3f} {:>10}", "schedule", schedule_average, schedule_max, schedule_shots);
+
+		std::println("speedup: {:.2f}x", churn_average / schedule_average);
+
+		return 0;
+	}
+
+	auto bench_health_bar(const std::uint32_t count) noexcept -> int
+	{
+		using namespace components;
+
+		constexpr std::uint32_t frames = 50;
+
+		entt::registry registry{};
+		registry.ctx().emplace<game::Interpolation>(1.f);
+		registry.ctx().emplace<health_bar::Options>(false);
+		registry.ctx().emplace<health_bar::Buffer>();
+		auto& [bounds, grid, visible_entities] = registry.ctx().emplace<camera::Visible>();
+
+		// 每3个敌人中有1个满血,每7个敌人中有1个已经死亡
+		std::size_t alive_count = 0;
+		std::size_t hurt_count = 0;
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			utility::Random random{2, i};
+
+			const auto entity = registry.create();
+			const auto full_health = i % 3 == 0;
+			const auto dead = i % 7 == 0;
+
+			registry.emplace<transform::Position>(entity, sf::Vector2f{random.real(0, 1280), random.real(0, 960)});
+			registry.emplace<enemy::Health>(entity, full_health ? 100.f : random.real(1, 99));
+			registry.emplace<health_bar::Health>(entity, 100.f);
+			registry.emplace<health_bar::Size>(entity, sf::Vector2f{16.f, 4.f});
+			registry.emplace<health_bar::Offset>(entity, sf::Vector2f{0.f, -12.f});
+
+			if (dead)
+			{
+				registry.emplace<tags::dead>(entity);
+			}
+			else
+			{
+				alive_count += 1;
+				if (not full_health)
+				{
+					hurt_count += 1;
+				}
+			}
+
+			visible_entities.push_back(entity);
+		}
+
+		auto result = 0;
+
+		std::println("{:<18} {:>10} {:>12} {:>12}", "hide_full_health", "bars", "vertices", "build(ms)");
+		for (const auto hide_full_health: {false, true})
+		{
+			registry.ctx().get<health_bar::Options>().hide_full_health = hide_full_health;
+
+			const auto expected_bars = hide_full_health ? hurt_count : alive_count;
+
+			std::size_t vertex_count = 0;
+			const auto build_ms = measure(frames, [&]() noexcept -> void { vertex_count = helper::HealthBar::build(registry); });
+
+			const auto& [enemies, vertices] = registry.ctx().get<const health_bar::Buffer>();
+
+			std::println("{:<18} {:>10} {:>12} {:>12.3f}", hide_full_health, enemies.size(), vertex_count, build_ms);
+
+			// 每个绘制的血条恰好12个顶点
+			if (enemies.size() != expected_bars or vertex_count != expected_bars * 12 or vertex_count > vertices.size())
+			{
+				std::println(stderr, "血条数量错误: 期望 {} 个血条 / {} 个顶点", expected_bars, expected_bars * 12);
+				result = 1;
+			}
+		}
+
+		return result;
+	}
+
+	auto bench_snapshot(const std::uint32_t count) noexcept -> int
+	{
+		using namespace components;
+
+		constexpr std::uint32_t times = 10;
+		constexpr std::uint32_t max_tower_count = 64;
+		constexpr std::uint32_t warmup_ticks = 120;
+
+		Runner runner{};
+		auto& registry = runner.registry();
+
+		// 构建波次中途的状态: 若干塔 + count个敌人,模拟若干步使敌人分散并开始交战
+		{
+			auto& [seed] = registry.ctx().get<game::Seed>();
+			seed = 0;
+
+			const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+			const auto& [start_gates] = registry.ctx().get<const map_ex::StartGate>();
+
+			auto& [selected_tower_type] = registry.ctx().get<player::Interaction>();
+			selected_tower_type = static_cast<combat::Type>(0x2000);
+
+			std::uint32_t tower_count = 0;
+			for (map::TileMap::size_type y = 0; y < tile_map.vertical_tile_count() and tower_count < max_tower_count; y += 3)
+			{
+				for (map::TileMap::size_type x = 0; x < tile_map.horizontal_tile_count() and tower_count < max_tower_count; x += 3)
+				{
+					if (tile_map.at(x, y) == map::TileType::BUILDABLE_FLOOR and helper::Player::try_build_tower(registry, tile_map.coordinate_grid_to_world(x, y)))
+					{
+						tower_count += 1;
+					}
+				}
+			}
+
+			helper::Wave::start_from_wave(registry, {.index = 0});
+
+			std::vector<entt::entity> enemies(count);
+			const auto gate_count = static_cast<std::uint32_t>(start_gates.size());
+			for (std::uint32_t gate = 0; gate < gate_count; ++gate)
+			{
+				const auto begin = static_cast<std::size_t>(count) * gate / gate_count;
+				const auto end = static_cast<std::size_t>(count) * (gate + 1) / gate_count;
+
+				factory::enemy(registry, gate, static_cast<combat::Type>(gate % 2), std::span{enemies}.subspan(begin, end - begin));
+			}
+
+			for (std::uint32_t tick = 0; tick < warmup_ticks; ++tick)
+			{
+				update::simulation(registry, update::simulation_step);
+			}
+		}
+
+		const auto entity_count = registry.storage<entt::entity>().free_list();
+
+		std::vector<std::byte> bytes;
+		const auto save_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				helper::Snapshot::save(registry, bytes);
+			}
+		);
+
+		std::error_code error_code;
+		const auto directory = std::filesystem::temp_directory_path(error_code) / "td_bench";
+		const auto path = directory / "bench.tdsave";
+
+		auto file_saved = true;
+		const auto save_file_ms = measure(
+			1,
+			[&]() noexcept -> void
+			{
+				file_saved = helper::Snapshot::save(registry, path);
+			}
+		);
+		if (not file_saved)
+		{
+			std::println(stderr, "无法写入快照: {}", path.string());
+			return 1;
+		}
+
+		auto loaded = true;
+		const auto load_ms = measure(
+			times,
+			[&]() noexcept -> void
+			{
+				loaded = helper::Snapshot::load(registry, bytes) and loaded;
+			}
+		);
+		if (not loaded)
+		{
+			std::println(stderr, "无法载入快照");
+			return 1;
+		}
+
+		// 载入后再次保存应该得到完全相同的快照
+		std::vector<std::byte> reloaded;
+		helper::Snapshot::save(registry, reloaded);
+		if (reloaded != bytes)
+		{
+			std::println(stderr, "载入后的快照不一致: {} / {} bytes", bytes.size(), reloaded.size());
+			return 1;
+		}
+
+		std::println("snapshot: {} entities, {} bytes ({:.1f} bytes/entity)", entity_count, bytes.size(), static_cast<double>(bytes.size()) / static_cast<double>(std::ranges::max(entity_count, std::size_t{1})));
+		std::println("{:<16} {:>12}", "stage", "avg(ms)");
+		std::println("{:<16} {:>12.3f}", "save (memory)", save_ms);
+		std::println("{:<16} {:>12.3f}", "save (file)", save_file_ms);
+		std::println("{:<16} {:>12.3f}", "load", load_ms);
+
+		std::filesystem::remove_all(directory, error_code);
+		return 0;
+	}
+}
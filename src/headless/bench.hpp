@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+namespace headless
+{
+	// 目录载入性能测试
+	// 生成包含count个敌人类型与count个塔类型的目录,比较解析JSON与映射二进制目录的耗时
+	[[nodiscard]] auto bench_catalogue(std::uint32_t count) noexcept -> int;
+
+	// 武器调度性能测试
+	// count个高射速的塔与足够多的目标,比较冷却调度(update::weapon)与逐帧增删冷却组件的旧实现中每个模拟步的耗时
+	[[nodiscard]] auto bench_weapon(std::uint32_t count) noexcept -> int;
+
+	// 精灵批处理顶点生成性能测试(不需要GPU)
+	// 生成count个精灵(分布在若干纹理上),统计每帧生成顶点的耗时与draw次数
+	[[nodiscard]] auto bench_sprites(std::uint32_t count) noexcept -> int;
+
+	// 纹理图集性能测试(不需要GPU)
+	// 将若干敌人纹理装箱为图集,比较count个精灵使用/不使用图集时的draw次数与生成顶点的耗时
+	[[nodiscard]] auto bench_atlas(std::uint32_t count) noexcept -> int;
+
+	// 顶点生成吞吐量测试(不需要GPU)
+	// 分别以单线程/线程池生成count个精灵与血条的顶点
+	[[nodiscard]] auto bench_vertices(std::uint32_t count) noexcept -> int;
+
+	// 血条顶点缓冲测试(不需要GPU)
+	// 视图内count个敌人(部分满血/已死亡),检查有无hide_full_health时顶点数量都恰好是绘制血条数量的12倍,并统计生成耗时
+	[[nodiscard]] auto bench_health_bar(std::uint32_t count) noexcept -> int;
+
+	// 配置查询性能测试
+	// 在包含count个条目的配置文件中执行count次查询,比较每次解析文件与使用文档缓存的耗时
+	[[nodiscard]] auto bench_config(std::uint32_t count) noexcept -> int;
+
+	// 地图载入性能测试
+	// 生成count*count的随机地图,比较逐点设置地块与映射二进制地图文件的耗时
+	[[nodiscard]] auto bench_map(std::uint32_t count) noexcept -> int;
+
+	// 资源载入性能测试
+	// 生成count个资源文件,比较逐个打开读取文件与映射资源包后查找读取的耗时
+	[[nodiscard]] auto bench_pack(std::uint32_t count) noexcept -> int;
+
+	// 快照性能测试
+	// 构建包含count个敌人的波次中途状态,统计保存(内存/文件)与载入快照的耗时,并检查载入后再次保存的结果是否一致
+	[[nodiscard]] auto bench_snapshot(std::uint32_t count) noexcept -> int;
+}
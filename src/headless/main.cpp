@@ -0,0 +1,311 @@
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+// =====================================
+// LOGGER
+#include <logger/logger.hpp>
+
+// =====================================
+// UPDATE
+#include <update/simulation.hpp>
+
+// =====================================
+// HELPER
+#include <helper/replay.hpp>
+
+// =====================================
+// HEADLESS
+#include <scenario.hpp>
+#include <runner.hpp>
+#include <bench.hpp>
+
+namespace
+{
+	[[nodiscard]] constexpr auto name_of(const headless::Outcome outcome) noexcept -> std::string_view
+	{
+		switch (outcome)
+		{
+			case headless::Outcome::VICTORY: { return "VICTORY"; }
+			case headless::Outcome::DEFEAT: { return "DEFEAT"; }
+			case headless::Outcome::TIMEOUT: { return "TIMEOUT"; }
+			case headless::Outcome::ENDED: { return "ENDED"; }
+		}
+
+		return "UNKNOWN";
+	}
+
+	auto print_report(const headless::Report& report) noexcept -> void
+	{
+		using namespace std::chrono;
+
+		const auto seconds = duration_cast<duration<double>>(report.elapsed).count();
+		const auto ticks_per_second = seconds > 0 ? static_cast<double>(report.ticks) / seconds : 0.;
+
+		std::println("outcome: {}", name_of(report.outcome));
+		std::println("ticks: {} ({:.3f}s simulated)", report.ticks, static_cast<double>(report.ticks) / 60.);
+		std::println("elapsed: {:.3f}s ({:.1f} ticks/sec)", seconds, ticks_per_second);
+		std::println("killed: {} / health: {} / gold: {}", report.killed_enemy, report.player_health, report.player_gold);
+		std::println("towers: {} built / {} failed", report.tower_built, report.tower_failed);
+		if (report.outcome == headless::Outcome::ENDED or report.command_applied + report.command_failed != 0)
+		{
+			std::println("commands: {} applied / {} failed", report.command_applied, report.command_failed);
+		}
+
+		std::println("{:<16} {:>12} {:>12} {:>8}", "system", "total(ms)", "avg(us)", "share");
+		for (const auto& [name, elapsed]: report.systems)
+		{
+			const auto total_ms = duration_cast<duration<double, std::milli>>(elapsed).count();
+			const auto average_us = report.ticks == 0 ? 0. : duration_cast<duration<double, std::micro>>(elapsed).count() / static_cast<double>(report.ticks);
+			const auto share = report.elapsed.count() == 0 ? 0. : static_cast<double>(elapsed.count()) / static_cast<double>(report.elapsed.count()) * 100.;
+
+			std::println("{:<16} {:>12.3f} {:>12.3f} {:>7.2f}%", name, total_ms, average_us, share);
+		}
+
+		if (report.tick_elapsed.empty())
+		{
+			return;
+		}
+
+		const auto to_us = [](const headless::Report::duration_type elapsed) noexcept -> double
+		{
+			return duration_cast<duration<double, std::micro>>(elapsed).count();
+		};
+
+		// 单个模拟步耗时分布
+		{
+			auto sorted = report.tick_elapsed;
+			std::ranges::sort(sorted);
+
+			const auto percentile = [&](const std::size_t p) noexcept -> double
+			{
+				return to_us(sorted[std::ranges::min(sorted.size() - 1, sorted.size() * p / 100)]);
+			};
+
+			std::println("tick(us): p50 {:.1f} / p90 {:.1f} / p99 {:.1f} / max {:.1f}", percentile(50), percentile(90), percentile(99), to_us(sorted.back()));
+		}
+
+		// 最慢的模拟步(回放时可以据此在指定模拟步附近分析)
+		{
+			constexpr std::size_t slowest_count = 10;
+
+			std::vector<std::size_t> ticks(report.tick_elapsed.size());
+			std::ranges::iota(ticks, std::size_t{0});
+
+			const auto count = std::ranges::min(slowest_count, ticks.size());
+			std::ranges::partial_sort(
+				ticks,
+				ticks.begin() + static_cast<std::ptrdiff_t>(count),
+				std::ranges::greater{},
+				[&](const std::size_t tick) noexcept -> headless::Report::duration_type
+				{
+					return report.tick_elapsed[tick];
+				}
+			);
+
+			std::println("{:<16} {:>12}", "slowest tick", "elapsed(us)");
+			for (const auto tick: ticks | std::views::take(count))
+			{
+				std::println("{:<16} {:>12.1f}", tick, to_us(report.tick_elapsed[tick]));
+			}
+		}
+	}
+
+	// 每个模拟步的耗时(CSV),用于离线分析
+	[[nodiscard]] auto write_timings(const headless::Report& report, const std::string_view path) noexcept -> bool
+	{
+		using namespace std::chrono;
+
+		std::ofstream file{std::filesystem::path{path}, std::ios::trunc};
+		if (not file.is_open())
+		{
+			return false;
+		}
+
+		std::println(file, "tick,elapsed_us");
+		for (const auto [tick, elapsed]: std::views::enumerate(report.tick_elapsed))
+		{
+			std::println(file, "{},{:.3f}", tick, duration_cast<duration<double, std::micro>>(elapsed).count());
+		}
+
+		return static_cast<bool>(file);
+	}
+}
+
+// td_headless [scenario.json] [--timings timings.csv] [--verbose]
+// td_headless --replay last.tdreplay [--timings timings.csv] [--verbose]
+// td_headless --bench-catalogue [count]
+// td_headless --bench-weapon [count]
+// td_headless --bench-sprites [count]
+// td_headless --bench-atlas [count]
+// td_headless --bench-vertices [count]
+// td_headless --bench-health-bar [count]
+// td_headless --bench-map [count]
+// td_headless --bench-config [count]
+// td_headless --bench-pack [count]
+// td_headless --bench-snapshot [count]
+auto main(const int argc, char** argv) noexcept -> int
+{
+	if (argc >= 2 and std::string_view{argv[1]}.starts_with("--bench-"))
+	{
+		const std::string_view bench{argv[1]};
+
+		const auto count = [&]() noexcept -> std::optional<std::uint32_t>
+		{
+			if (argc < 3)
+			{
+				return std::nullopt;
+			}
+
+			std::uint32_t value = 0;
+			const std::string_view arg{argv[2]};
+			if (const auto [ptr, error] = std::from_chars(arg.data(), arg.data() + arg.size(), value);
+				error != std::errc{})
+			{
+				return std::nullopt;
+			}
+
+			return value;
+		}();
+
+		logger::Logger::set_level(logger::Level::WARNING);
+		logger::Logger::start({}, true);
+
+		auto result = 1;
+		if (bench == "--bench-catalogue")
+		{
+			result = headless::bench_catalogue(count.value_or(10'000));
+		}
+		else if (bench == "--bench-weapon")
+		{
+			result = headless::bench_weapon(count.value_or(1'000));
+		}
+		else if (bench == "--bench-sprites")
+		{
+			result = headless::bench_sprites(count.value_or(5'000));
+		}
+		else if (bench == "--bench-atlas")
+		{
+			result = headless::bench_atlas(count.value_or(50'000));
+		}
+		else if (bench == "--bench-vertices")
+		{
+			// 不指定数量则依次测试10k/50k/100k
+			result = headless::bench_vertices(count.value_or(0));
+		}
+		else if (bench == "--bench-health-bar")
+		{
+			result = headless::bench_health_bar(count.value_or(10'000));
+		}
+		else if (bench == "--bench-config")
+		{
+			result = headless::bench_config(count.value_or(1'000));
+		}
+		else if (bench == "--bench-map")
+		{
+			result = headless::bench_map(count.value_or(4'096));
+		}
+		else if (bench == "--bench-pack")
+		{
+			result = headless::bench_pack(count.value_or(2'000));
+		}
+		else if (bench == "--bench-snapshot")
+		{
+			result = headless::bench_snapshot(count.value_or(50'000));
+		}
+		else
+		{
+			std::println(stderr, "未知的性能测试: {}", bench);
+		}
+
+		logger::Logger::stop();
+		return result;
+	}
+
+	std::string_view scenario_path{"data/scenario/default.json"};
+	std::string_view replay_path{};
+	std::string_view timings_path{};
+	auto verbose = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (const std::string_view arg{argv[i]};
+			arg == "--verbose")
+		{
+			verbose = true;
+		}
+		else if (arg == "--replay" and i + 1 < argc)
+		{
+			replay_path = argv[++i];
+		}
+		else if (arg == "--timings" and i + 1 < argc)
+		{
+			timings_path = argv[++i];
+		}
+		else
+		{
+			scenario_path = arg;
+		}
+	}
+
+	// 默认只记录警告以上的日志,避免日志影响性能统计
+	logger::Logger::set_level(verbose ? logger::Level::TRACE : logger::Level::WARNING);
+	logger::Logger::start("logs/td_headless.log", verbose);
+
+	const auto report = [&]() noexcept -> std::optional<headless::Report>
+	{
+		if (not replay_path.empty())
+		{
+			const auto log = helper::Replay::load(replay_path);
+			if (not log.has_value())
+			{
+				std::println(stderr, "无法载入回放: {}", replay_path);
+				return std::nullopt;
+			}
+
+			if (static_cast<std::int64_t>(log->step) != update::simulation_step.asMicroseconds())
+			{
+				std::println(stderr, "回放的模拟步长({}us)与当前({}us)不一致", log->step, update::simulation_step.asMicroseconds());
+				return std::nullopt;
+			}
+
+			std::println("replay: {} (seed: 0x{:016x}, {} ticks, {} commands)", replay_path, log->seed, log->tick_count, log->commands.size());
+
+			headless::Runner runner{};
+			return runner.replay(*log);
+		}
+
+		const auto scenario = headless::Scenario::load(scenario_path);
+		if (not scenario.has_value())
+		{
+			std::println(stderr, "无法载入脚本: {}", scenario_path);
+			return std::nullopt;
+		}
+
+		headless::Runner runner{};
+		return runner.run(*scenario);
+	}();
+
+	if (not report.has_value())
+	{
+		logger::Logger::stop();
+		return 1;
+	}
+
+	print_report(*report);
+
+	if (not timings_path.empty() and not write_timings(*report, timings_path))
+	{
+		std::println(stderr, "无法写入: {}", timings_path);
+	}
+
+	logger::Logger::stop();
+	return 0;
+}
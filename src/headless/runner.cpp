@@ -0,0 +1,295 @@
+#include <runner.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+// ================
+// COMPONENTS
+
+#include <components/game/game.hpp>
+#include <components/game/player.hpp>
+#include <components/game/replay.hpp>
+#include <components/game/wave.hpp>
+#include <components/map/map.hpp>
+
+// ================
+// INITIALIZE
+
+#include <initialize/map_data.hpp>
+#include <initialize/wave_data.hpp>
+#include <initialize/prefab_data.hpp>
+#include <initialize/event_connection.hpp>
+#include <initialize/game.hpp>
+#include <initialize/navigation.hpp>
+#include <initialize/observer.hpp>
+#include <initialize/weapon.hpp>
+#include <initialize/player.hpp>
+
+// ================
+// UPDATE
+
+#include <update/simulation.hpp>
+
+// ================
+// HELPER
+
+#include <helper/player.hpp>
+#include <helper/wave.hpp>
+#include <helper/replay.hpp>
+
+// ================
+// DEPENDENCIES
+
+#include <entt/entt.hpp>
+
+namespace
+{
+	using clock_type = std::chrono::steady_clock;
+
+	using headless::Outcome;
+	using headless::Report;
+
+	[[nodiscard]] auto make_report() noexcept -> Report
+	{
+		const auto simulation_systems = update::simulation_scheduler().systems();
+
+		Report report{
+				.outcome = Outcome::TIMEOUT,
+				.ticks = 0,
+				.elapsed = Report::duration_type::zero(),
+				.systems = {},
+				.tick_elapsed = {},
+				.killed_enemy = 0,
+				.player_health = 0,
+				.player_gold = 0,
+				.tower_built = 0,
+				.tower_failed = 0,
+				.command_applied = 0,
+				.command_failed = 0
+		};
+		report.systems.reserve(simulation_systems.size());
+		std::ranges::transform(
+			simulation_systems,
+			std::back_inserter(report.systems),
+			[](const update::Scheduler::System& system) noexcept -> Report::System
+			{
+				return {.name = system.name, .elapsed = Report::duration_type::zero()};
+			}
+		);
+
+		return report;
+	}
+
+	// 执行一个模拟步,返回游戏是否结束
+	[[nodiscard]] auto step(entt::registry& registry, Report& report, const std::span<Report::duration_type> simulation_elapsed) noexcept -> bool
+	{
+		using namespace components;
+
+		update::simulation_scheduler().run(registry, update::simulation_step, simulation_elapsed);
+
+		report.ticks += 1;
+
+		const auto& [player_resource] = registry.ctx().get<const player::Resource>();
+		if (const auto health = player_resource.find(resource::Type::HEALTH);
+			health == player_resource.end() or health->second <= 0)
+		{
+			report.outcome = Outcome::DEFEAT;
+			return true;
+		}
+
+		if (const auto [wave_current_index] = registry.ctx().get<const wave::WaveCurrentIndex>();
+			wave_current_index == wave::wave_all_completed)
+		{
+			report.outcome = Outcome::VICTORY;
+			return true;
+		}
+
+		return false;
+	}
+
+	auto finish(const entt::registry& registry, Report& report, const std::span<const Report::duration_type> simulation_elapsed) noexcept -> void
+	{
+		using namespace components;
+
+		for (const auto [statistics, elapsed]: std::views::zip(report.systems, simulation_elapsed))
+		{
+			statistics.elapsed = elapsed;
+		}
+
+		const auto [killed_enemy] = registry.ctx().get<const player::Statistics>();
+		report.killed_enemy = killed_enemy;
+
+		const auto& [player_resource] = registry.ctx().get<const player::Resource>();
+		const auto resource_of = [&](const resource::Type type) noexcept -> std::uint32_t
+		{
+			if (const auto it = player_resource.find(type);
+				it != player_resource.end())
+			{
+				return static_cast<std::uint32_t>(std::ranges::max(it->second, resource::size_type{0}));
+			}
+
+			return 0;
+		};
+		report.player_health = resource_of(resource::Type::HEALTH);
+		report.player_gold = resource_of(resource::Type::GOLD);
+	}
+}
+
+namespace headless
+{
+	Runner::~Runner() noexcept = default;
+
+	Runner::Runner() noexcept
+	{
+		// 与scene::Game相同,但是不加载资源/背景/HUD
+
+		initialize::map_data(registry_);
+		initialize::wave_data(registry_);
+		initialize::prefab_data(registry_);
+
+		initialize::event_connection(registry_);
+
+		initialize::game(registry_);
+		initialize::navigation(registry_);
+		initialize::observer(registry_);
+		initialize::weapon(registry_);
+		initialize::player(registry_);
+	}
+
+	auto Runner::registry() noexcept -> entt::registry&
+	{
+		return registry_;
+	}
+
+	auto Runner::run(const Scenario& scenario) noexcept -> Report
+	{
+		using namespace components;
+
+		auto report = make_report();
+		report.tick_elapsed.reserve(scenario.max_ticks);
+
+		// 调度器按系统索引累计耗时
+		std::vector<Report::duration_type> simulation_elapsed(report.systems.size(), Report::duration_type::zero());
+
+		// 使用脚本指定的种子,保证结果可复现
+		auto& [seed] = registry_.ctx().get<game::Seed>();
+		seed = scenario.seed;
+
+		auto tower_iterator = scenario.towers.begin();
+		auto wave_iterator = scenario.waves.begin();
+
+		const auto& [tile_map] = registry_.ctx().get<const map_ex::TileMap>();
+
+		const auto run_start = clock_type::now();
+
+		for (Scenario::tick_type tick = 0; tick < scenario.max_ticks; ++tick)
+		{
+			const auto tick_start = clock_type::now();
+
+			// 脚本
+			for (; tower_iterator != scenario.towers.end() and tower_iterator->tick <= tick; ++tower_iterator)
+			{
+				auto& [selected_tower_type] = registry_.ctx().get<player::Interaction>();
+				selected_tower_type = tower_iterator->type;
+
+				if (helper::Player::try_build_tower(registry_, tile_map.coordinate_grid_to_world(tower_iterator->point)))
+				{
+					report.tower_built += 1;
+				}
+				else
+				{
+					report.tower_failed += 1;
+				}
+			}
+			for (; wave_iterator != scenario.waves.end() and wave_iterator->tick <= tick; ++wave_iterator)
+			{
+				helper::Wave::start_from_wave(registry_, {.index = wave_iterator->index});
+			}
+
+			// 模拟
+			const auto finished = step(registry_, report, simulation_elapsed);
+
+			report.tick_elapsed.push_back(clock_type::now() - tick_start);
+
+			if (finished)
+			{
+				break;
+			}
+		}
+
+		report.elapsed = clock_type::now() - run_start;
+
+		finish(registry_, report, simulation_elapsed);
+
+		return report;
+	}
+
+	auto Runner::replay(const helper::Replay::Log& log) noexcept -> Report
+	{
+		using namespace components;
+
+		auto report = make_report();
+		report.outcome = Outcome::ENDED;
+		report.tick_elapsed.reserve(log.tick_count);
+
+		std::vector<Report::duration_type> simulation_elapsed(report.systems.size(), Report::duration_type::zero());
+
+		// 使用录制时的种子
+		auto& [seed] = registry_.ctx().get<game::Seed>();
+		seed = log.seed;
+
+		auto command_iterator = log.commands.begin();
+
+		const auto run_start = clock_type::now();
+
+		for (std::uint64_t tick = 0; tick < log.tick_count; ++tick)
+		{
+			const auto tick_start = clock_type::now();
+
+			// 录制时在第tick个模拟步完成后执行的指令
+			for (; command_iterator != log.commands.end() and command_iterator->tick <= tick; ++command_iterator)
+			{
+				// 录制的指令在录制时都执行成功了,失败说明回放与录制时不一致
+				const auto applied = helper::Replay::apply(registry_, *command_iterator);
+
+				if (applied)
+				{
+					report.command_applied += 1;
+				}
+				else
+				{
+					report.command_failed += 1;
+				}
+
+				if (command_iterator->type == replay::CommandType::BUILD_TOWER)
+				{
+					if (applied)
+					{
+						report.tower_built += 1;
+					}
+					else
+					{
+						report.tower_failed += 1;
+					}
+				}
+			}
+
+			const auto finished = step(registry_, report, simulation_elapsed);
+
+			report.tick_elapsed.push_back(clock_type::now() - tick_start);
+
+			if (finished)
+			{
+				break;
+			}
+		}
+
+		report.elapsed = clock_type::now() - run_start;
+
+		finish(registry_, report, simulation_elapsed);
+
+		return report;
+	}
+}
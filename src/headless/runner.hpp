@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <scenario.hpp>
+
+#include <helper/replay.hpp>
+
+#include <entt/entity/registry.hpp>
+
+namespace headless
+{
+	// 运行结果
+	enum class Outcome : std::uint8_t
+	{
+		// 所有波次结束
+		VICTORY,
+		// 玩家生命值耗尽
+		DEFEAT,
+		// 超出最大模拟步数
+		TIMEOUT,
+		// 到达录制结束时的模拟步数(回放)
+		ENDED,
+	};
+
+	class Report
+	{
+	public:
+		using duration_type = std::chrono::nanoseconds;
+
+		// 单个系统的累计耗时
+		class System
+		{
+		public:
+			std::string_view name;
+			duration_type elapsed;
+		};
+
+		Outcome outcome;
+
+		Scenario::tick_type ticks;
+		duration_type elapsed;
+
+		std::vector<System> systems;
+		// 每个模拟步的耗时(包括执行脚本/回放指令),用于定位卡顿
+		std::vector<duration_type> tick_elapsed;
+
+		std::uint32_t killed_enemy;
+		std::uint32_t player_health;
+		std::uint32_t player_gold;
+		std::uint32_t tower_built;
+		std::uint32_t tower_failed;
+
+		// 回放指令执行结果(失败说明回放与录制时不一致)
+		std::uint32_t command_applied;
+		std::uint32_t command_failed;
+	};
+
+	// 不依赖窗口/音频/ImGui,以固定步长运行模拟
+	class Runner
+	{
+	public:
+		Runner(const Runner&) noexcept = delete;
+		Runner(Runner&&) noexcept = delete;
+		auto operator=(const Runner&) noexcept -> Runner& = delete;
+		auto operator=(Runner&&) noexcept -> Runner& = delete;
+
+	private:
+		entt::registry registry_;
+
+	public:
+		~Runner() noexcept;
+
+		Runner() noexcept;
+
+		[[nodiscard]] auto registry() noexcept -> entt::registry&;
+
+		[[nodiscard]] auto run(const Scenario& scenario) noexcept -> Report;
+
+		// 以最快速度重新执行录制的指令(使用录制时的种子)
+		[[nodiscard]] auto replay(const helper::Replay::Log& log) noexcept -> Report;
+	};
+}
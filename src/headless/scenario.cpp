@@ -0,0 +1,125 @@
+#include <scenario.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+	// 读取无符号整数字段(不存在时使用默认值)
+	// 类型不匹配或超出范围时返回nullopt(json.value会抛出异常)
+	template<typename T>
+	[[nodiscard]] auto unsigned_of(const nlohmann::json& json, const std::string_view key, const T default_value) noexcept -> std::optional<T>
+	{
+		const auto it = json.find(key);
+		if (it == json.end())
+		{
+			return default_value;
+		}
+
+		if (not it->is_number_unsigned())
+		{
+			return std::nullopt;
+		}
+
+		const auto value = it->get_ref<const nlohmann::json::number_unsigned_t&>();
+		if (value > std::numeric_limits<T>::max())
+		{
+			return std::nullopt;
+		}
+
+		return static_cast<T>(value);
+	}
+}
+
+namespace headless
+{
+	auto Scenario::load(const std::filesystem::path& path) noexcept -> std::optional<Scenario>
+	{
+		std::ifstream file{path};
+
+		if (not file.is_open())
+		{
+			return std::nullopt;
+		}
+
+		const auto json = nlohmann::json::parse(file, nullptr, false);
+
+		if (json.is_discarded() or not json.is_object())
+		{
+			return std::nullopt;
+		}
+
+		// 默认最多模拟10分钟
+		const auto seed = unsigned_of(json, "seed", std::uint64_t{0});
+		const auto max_ticks = unsigned_of(json, "max_ticks", tick_type{60 * 60 * 10});
+		if (not seed.has_value() or not max_ticks.has_value())
+		{
+			return std::nullopt;
+		}
+
+		Scenario scenario{
+				.seed = *seed,
+				.max_ticks = *max_ticks,
+				.towers = {},
+				.waves = {}
+		};
+
+		if (const auto it = json.find("towers");
+			it != json.end() and it->is_array())
+		{
+			for (const auto& tower: *it)
+			{
+				if (not tower.is_object())
+				{
+					return std::nullopt;
+				}
+
+				const auto tick = unsigned_of(tower, "tick", tick_type{0});
+				const auto x = unsigned_of(tower, "x", 0u);
+				const auto y = unsigned_of(tower, "y", 0u);
+				const auto type = unsigned_of(tower, "type", components::combat::type_underlying_type{0x2000});
+				if (not tick.has_value() or not x.has_value() or not y.has_value() or not type.has_value())
+				{
+					return std::nullopt;
+				}
+
+				scenario.towers.emplace_back(*tick, sf::Vector2u{*x, *y}, static_cast<components::combat::Type>(*type));
+			}
+		}
+
+		if (const auto it = json.find("waves");
+			it != json.end() and it->is_array())
+		{
+			for (const auto& wave: *it)
+			{
+				if (not wave.is_object())
+				{
+					return std::nullopt;
+				}
+
+				const auto tick = unsigned_of(wave, "tick", tick_type{0});
+				const auto index = unsigned_of(wave, "index", components::wave::index_type{0});
+				if (not tick.has_value() or not index.has_value())
+				{
+					return std::nullopt;
+				}
+
+				scenario.waves.emplace_back(*tick, *index);
+			}
+		}
+		else
+		{
+			// 默认从第一个波次开始
+			scenario.waves.emplace_back(tick_type{0}, components::wave::index_type{0});
+		}
+
+		std::ranges::stable_sort(scenario.towers, std::ranges::less{}, &Tower::tick);
+		std::ranges::stable_sort(scenario.waves, std::ranges::less{}, &Wave::tick);
+
+		return scenario;
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <components/combat/unit.hpp>
+#include <components/game/wave.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace headless
+{
+	// 无界面模拟脚本
+	class Scenario
+	{
+	public:
+		using tick_type = std::uint64_t;
+
+		// 在指定模拟步建造塔
+		class Tower
+		{
+		public:
+			tick_type tick;
+			sf::Vector2u point;
+			components::combat::Type type;
+		};
+
+		// 在指定模拟步从指定波次开始
+		class Wave
+		{
+		public:
+			tick_type tick;
+			components::wave::index_type index;
+		};
+
+		// 随机数种子(相同的种子与脚本得到相同的结果)
+		std::uint64_t seed;
+
+		// 最大模拟步数(超出视为超时)
+		tick_type max_ticks;
+
+		// 按tick排序
+		std::vector<Tower> towers;
+		// 按tick排序
+		std::vector<Wave> waves;
+
+		[[nodiscard]] static auto load(const std::filesystem::path& path) noexcept -> std::optional<Scenario>;
+	};
+}
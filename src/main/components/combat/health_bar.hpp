@@ -1,5 +1,10 @@
 #pragma once
 
+#include <vector>
+
+#include <entt/entity/fwd.hpp>
+
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
 
 namespace components::health_bar
@@ -28,4 +33,23 @@ namespace components::health_bar
 
 	// 血条位置
 	// entity::position + Offset
+
+	// 血条显示选项(registry.ctx)
+	class Options
+	{
+	public:
+		// 不绘制满血敌人的血条
+		bool hide_full_health;
+	};
+
+	// 血条顶点缓冲(registry.ctx)
+	// 只在需要更多空间时扩容,帧之间复用
+	class Buffer
+	{
+	public:
+		// 本帧需要绘制血条的敌人
+		std::vector<entt::entity> enemies;
+		// 顶点(只有前 enemies.size() * 12 个有效)
+		std::vector<sf::Vertex> vertices;
+	};
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <deque>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include <entt/fwd.hpp>
 
@@ -14,10 +17,23 @@ namespace components::combat
 	constexpr auto invalid_type = static_cast<Type>(std::numeric_limits<type_underlying_type>::max());
 
 	// 实体名称
+	// 只保存名称表中的索引,同一类型的实体共享同一个名称
+	// 显示名称(name #EID)只在需要时生成(helper::Name)
 	class Name
 	{
 	public:
-		std::string name;
+		using id_type = std::uint32_t;
+
+		id_type id;
+	};
+
+	// 名称表(registry.ctx)
+	class NameTable
+	{
+	public:
+		// deque保证添加名称时已有的字符串地址不变
+		std::deque<std::string> names;
+		std::unordered_map<std::string_view, Name::id_type> ids;
 	};
 
 	// 死亡回调(可选)
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
 #include <entt/entity/fwd.hpp>
 
+#include <SFML/System/Time.hpp>
+
 namespace components::weapon
 {
 	// 攻击距离
@@ -18,11 +25,12 @@ namespace components::weapon
 		float fire_rate;
 	};
 
-	// 武器冷却(如果处于冷却状态)
+	// 武器冷却
+	// 记录武器下一次可以开火的时间(基于模拟历时),武器始终持有该组件
 	class Cooldown
 	{
 	public:
-		float delay;
+		sf::Time ready_time;
 	};
 
 	// 开火
@@ -40,4 +48,17 @@ namespace components::weapon
 	public:
 		entt::entity entity;
 	};
+
+	// 武器冷却调度(registry.ctx)
+	// 冷却中的武器只存在于按冷却结束时间排序的队列中,不会被逐帧遍历
+	class Schedule
+	{
+	public:
+		using entry_type = std::pair<sf::Time, entt::entity>;
+
+		// 冷却中的武器(冷却结束时间最早的位于队首)
+		std::priority_queue<entry_type, std::vector<entry_type>, std::greater<>> cooling;
+		// 冷却结束,等待开火的武器
+		std::vector<entt::entity> ready;
+	};
 }
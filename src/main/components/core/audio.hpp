@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include <entt/core/fwd.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace components::audio
+{
+	class Emission
+	{
+	public:
+		// 音效ID
+		entt::id_type sound;
+		// 声源位置(世界坐标)
+		sf::Vector2f position;
+	};
+
+	// 本帧的所有声源(registry.ctx)
+	// 触发时只记录,由update::audio统一剔除/合并后播放
+	class Emissions
+	{
+	public:
+		std::vector<Emission> emissions;
+		// 不存在(解码失败)的音效,只警告一次
+		std::vector<entt::id_type> missing;
+	};
+}
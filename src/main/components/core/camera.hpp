@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+
+#include <graphics/spatial_grid.hpp>
+
+#include <entt/entity/fwd.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace components::camera
+{
+	// 相机(registry.ctx)
+	class Camera
+	{
+	public:
+		// 视图中心(世界坐标)
+		sf::Vector2f center;
+		// 缩放(大于1时可以看到更大的范围)
+		float zoom;
+		// 视口大小(窗口像素),每帧渲染时更新
+		sf::Vector2f viewport;
+	};
+
+	// 可见实体(registry.ctx)
+	// 每帧渲染前由render::cull更新
+	class Visible
+	{
+	public:
+		// 视图范围(世界坐标)
+		sf::FloatRect bounds;
+		// 所有可渲染实体
+		graphics::SpatialGrid grid;
+		// 视图内的可渲染实体(粗略结果)
+		std::vector<entt::entity> entities;
+	};
+}
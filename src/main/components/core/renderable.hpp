@@ -1,5 +1,7 @@
 #pragma once
 
+#include <graphics/sprite_batch.hpp>
+
 #include <entt/fwd.hpp>
 
 #include <SFML/System/Vector2.hpp>
@@ -31,4 +33,12 @@ namespace components::renderable
 	public:
 		sf::Color color;
 	};
+
+	// 精灵批次(registry.ctx)
+	// 帧之间复用,随场景销毁
+	class Batch
+	{
+	public:
+		graphics::SpriteBatch batch;
+	};
 }
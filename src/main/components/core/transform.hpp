@@ -11,6 +11,14 @@ namespace components::transform
 		sf::Vector2f position;
 	};
 
+	// 上一个模拟步的位置(仅移动的实体持有)
+	// 渲染时在两次模拟之间插值
+	class PreviousPosition
+	{
+	public:
+		sf::Vector2f position;
+	};
+
 	class Scale
 	{
 	public:
@@ -4,6 +4,8 @@
 #include <loaders/font.hpp>
 #include <loaders/texture.hpp>
 #include <loaders/sound.hpp>
+#include <loaders/preloader.hpp>
+#include <loaders/reloader.hpp>
 
 #include <entt/core/hashed_string.hpp>
 #include <entt/resource/cache.hpp>
@@ -36,6 +38,9 @@ namespace components::asset
 
 		// ================
 		// SOUND
+
+		// 攻击音效
+		constexpr auto laser = "laser"_hs;
 	}
 
 	class Configs
@@ -61,4 +66,19 @@ namespace components::asset
 	public:
 		entt::resource_cache<loaders::SoundResource, loaders::Sound> sounds;
 	};
+
+	// 正在预加载的资源(registry.ctx)
+	// 所有资源载入完成后移除
+	class Loading
+	{
+	public:
+		loaders::Preloader preloader;
+	};
+
+	// 资源热重载(registry.ctx),默认不启用
+	class HotReload
+	{
+	public:
+		loaders::Reloader reloader;
+	};
 }
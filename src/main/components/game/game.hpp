@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstdint>
+
+#include <utility/command_buffer.hpp>
+#include <utility/random.hpp>
+
 #include <SFML/System/Time.hpp>
 
 namespace components::game
@@ -26,4 +31,40 @@ namespace components::game
 	public:
 		sf::Time elapsed;
 	};
+
+	// 模拟步数(固定步长)
+	class SimulationTick
+	{
+	public:
+		std::uint64_t tick;
+	};
+
+	// 延迟执行的结构性修改(在调度器的同步点执行)
+	class Commands
+	{
+	public:
+		utility::CommandBuffer commands;
+	};
+
+	// 本局游戏的随机数种子
+	// 所有模拟中使用的随机数都由该种子派生(utility::Random)
+	class Seed
+	{
+	public:
+		utility::Random::seed_type seed;
+	};
+
+	// 已生成的敌人数量(作为每个敌人的随机数流)
+	class SpawnCounter
+	{
+	public:
+		std::uint64_t count;
+	};
+
+	// 渲染插值系数([0, 1], 累积但还未模拟的时间 / 模拟步长)
+	class Interpolation
+	{
+	public:
+		float alpha;
+	};
 }
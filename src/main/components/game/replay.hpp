@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace components::replay
+{
+	// 玩家指令(模拟只由种子与指令决定,回放时按顺序重新执行即可复现整局游戏)
+	enum class CommandType : std::uint32_t
+	{
+		// 建造塔(网格坐标 + 塔类型)
+		BUILD_TOWER,
+		// 销毁塔(网格坐标)
+		DESTROY_TOWER,
+		// 跳过准备时间
+		SKIP_PREPARATION,
+		// 下一波次提前开始
+		EARLY_START,
+		// 从指定波次开始(波次索引)
+		START_WAVE,
+		// 生成指定波次(波次索引)
+		SPAWN_WAVE,
+		// 生成敌人(出生点 + 敌人类型)
+		SPAWN_ENEMY,
+		// 直接获取资源(资源类型 + 数量)
+		ACQUIRE_RESOURCE,
+	};
+
+	// 直接写入回放文件,不要添加非平凡类型的成员
+	class Command
+	{
+	public:
+		// 在第tick个模拟步完成后(下一个模拟步开始前)执行
+		std::uint64_t tick;
+
+		CommandType type;
+		// 塔类型/波次索引/敌人类型/资源类型
+		std::uint32_t value;
+		// 网格坐标/出生点(x)/资源数量(x为低32位,y为高32位)
+		std::uint32_t x;
+		std::uint32_t y;
+	};
+
+	// 录制中的指令(registry.ctx)
+	// 不存在时不录制(例如回放/无界面模拟)
+	class Recording
+	{
+	public:
+		// 按tick排序
+		std::vector<Command> commands;
+	};
+}
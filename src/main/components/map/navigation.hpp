@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include <map/flow_field.hpp>
 
+#include <SFML/Graphics/Vertex.hpp>
+
 namespace components::navigation
 {
 	// 地面洋流图
@@ -20,4 +23,20 @@ namespace components::navigation
 		// start_gate => path
 		std::vector<map::path_type> cache_paths;
 	};
+
+	// 导航调试绘制缓存
+	// 流场与缓存路径只在建造/销毁塔时变化,此时才需要更新顶点
+	class Overlay
+	{
+	public:
+		// 顶点对应的流场版本(FlowField::generation)
+		std::uint32_t generation;
+
+		// 生成顶点时每个网格的流向(逐行存储),只更新流向变化的网格
+		std::vector<map::Direction> directions;
+		// 每个网格6个顶点(Lines),逐行存储
+		std::vector<sf::Vertex> arrows;
+		// 所有缓存路径(Lines)
+		std::vector<sf::Vertex> paths;
+	};
 }
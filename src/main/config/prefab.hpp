@@ -0,0 +1,103 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include <components/core/transform.hpp>
+#include <components/core/renderable.hpp>
+#include <components/core/sprite_frame.hpp>
+#include <components/combat/unit.hpp>
+#include <components/combat/enemy.hpp>
+#include <components/combat/health_bar.hpp>
+#include <components/combat/weapon.hpp>
+
+#include <loaders/catalogue.hpp>
+
+namespace config::prefab
+{
+	// 敌人预制体
+	// 同一类型的所有敌人共享这些组件的初始值,生成时直接批量复制到各个组件存储
+	// 生成时由目录中的记录构建
+	class Enemy
+	{
+	public:
+		// transform
+		components::transform::Scale scale;
+		components::transform::Rotation rotation;
+
+		// renderable
+		components::renderable::Texture texture;
+		components::renderable::Area area;
+		components::renderable::Origin origin;
+		components::renderable::Color color;
+
+		// sprite_frame
+		components::sprite_frame::Timer timer;
+		components::sprite_frame::Condition condition;
+		components::sprite_frame::Frame frame;
+		components::sprite_frame::Uniform uniform;
+
+		// 名称(实际名称为 name #EID),引用目录中的字符串
+		std::string_view name;
+
+		// 移动方式
+		components::enemy::Archetype archetype;
+
+		// 生命值
+		components::enemy::Health health;
+		// 移动速度(基础值 + [0, movement_variance)的随机值)
+		components::enemy::Movement movement;
+		float movement_variance;
+		// 强度(基础值 + [0, power_variance]的随机值)
+		components::enemy::Power power;
+		components::enemy::Power::value_type power_variance;
+
+		// 血条
+		components::health_bar::Size health_bar_size;
+		components::health_bar::Offset health_bar_offset;
+	};
+
+	// 塔预制体
+	class Tower
+	{
+	public:
+		// transform
+		components::transform::Scale scale;
+		components::transform::Rotation rotation;
+
+		// renderable
+		components::renderable::Texture texture;
+		components::renderable::Area area;
+		components::renderable::Origin origin;
+		components::renderable::Color color;
+
+		// sprite_frame
+		components::sprite_frame::Timer timer;
+		components::sprite_frame::Condition condition;
+		components::sprite_frame::Frame frame;
+		components::sprite_frame::Uniform uniform;
+
+		// 名称(实际名称为 name #EID),引用目录中的字符串
+		std::string_view name;
+
+		// 武器
+		components::weapon::Range range;
+		components::weapon::FireRate fire_rate;
+		components::weapon::Trigger trigger;
+
+		// 索敌类型
+		components::enemy::Archetype targeting;
+	};
+
+	// 所有预制体(registry.ctx)
+	class Prefabs
+	{
+	public:
+		// 敌人/塔定义目录(内存映射)
+		std::optional<loaders::Catalogue> catalogue;
+
+		// 目录中不存在的类型使用默认预制体
+		Enemy default_enemy;
+		Tower default_tower;
+	};
+}
@@ -1,32 +1,109 @@
 #include <factory/enemy.hpp>
 
-#include <random>
+#include <utility>
+#include <vector>
+
+#include <config/prefab.hpp>
 
 #include <components/core/tags.hpp>
-#include <components/core/transform.hpp>
-#include <components/core/renderable.hpp>
-#include <components/core/sprite_frame.hpp>
-#include <components/combat/enemy.hpp>
-#include <components/combat/health_bar.hpp>
+#include <components/game/game.hpp>
 #include <components/map/map.hpp>
 #include <components/map/navigation.hpp>
 
+#include <helper/name.hpp>
+
+#include <utility/random.hpp>
+
 #include <entt/entt.hpp>
 
+namespace
+{
+	[[nodiscard]] auto prefab_of(const entt::registry& registry, const components::combat::Type type) noexcept -> config::prefab::Enemy
+	{
+		using namespace components;
+
+		const auto& prefabs = registry.ctx().get<const config::prefab::Prefabs>();
+
+		if (not prefabs.catalogue.has_value())
+		{
+			return prefabs.default_enemy;
+		}
+
+		const auto& catalogue = *prefabs.catalogue;
+		const auto* record = catalogue.enemy_of(type);
+		if (record == nullptr)
+		{
+			return prefabs.default_enemy;
+		}
+
+		const auto& sprite = record->sprite;
+		const auto frame_size = sf::Vector2i{sprite.frame_width, sprite.frame_height};
+
+		return
+		{
+				.scale = {.scale = {sprite.scale, sprite.scale}},
+				.rotation = {.rotation = sf::degrees(0)},
+				.texture = {.id = sprite.texture_id},
+				.area = {.area = sf::IntRect{{0, 0}, frame_size}},
+				.origin = {.origin = sf::Vector2f{frame_size / 2}},
+				.color = {.color = sf::Color::White},
+				.timer = {.frame_duration = sf::seconds(sprite.frame_duration), .elapsed_time = sf::Time::Zero},
+				.condition = {.looping = sprite.looping != 0, .playing = true},
+				.frame = {.total_count = sprite.frame_count, .current_index = 0},
+				.uniform = {.frame_position = {0, 0}, .frame_size = frame_size},
+				.name = catalogue.string_of(record->name),
+				.archetype = static_cast<enemy::Archetype>(record->archetype),
+				.health = {.health = record->health},
+				.movement = {.speed = record->speed},
+				.movement_variance = record->speed_variance,
+				.power = {.power = record->power},
+				.power_variance = record->power_variance,
+				.health_bar_size = {.size = {static_cast<float>(frame_size.x), static_cast<float>(frame_size.y / 4)}}, // NOLINT(bugprone-integer-division)
+				.health_bar_offset = {.offset = {static_cast<float>(-frame_size.x / 2), -static_cast<float>(frame_size.y / 2) - 5.f}}, // NOLINT(bugprone-integer-division)
+		};
+	}
+}
+
 namespace factory
 {
 	auto enemy(entt::registry& registry, const sf::Vector2u point, const components::combat::Type type) noexcept -> entt::entity
+	{
+		entt::entity entity;
+		enemy(registry, point, type, {&entity, 1});
+
+		return entity;
+	}
+
+	auto enemy(entt::registry& registry, const std::uint32_t start_gate_id, const components::combat::Type type) noexcept -> entt::entity
+	{
+		entt::entity entity;
+		enemy(registry, start_gate_id, type, {&entity, 1});
+
+		return entity;
+	}
+
+	auto enemy(entt::registry& registry, const sf::Vector2u point, const components::combat::Type type, const std::span<entt::entity> entities) noexcept -> void
 	{
 		using namespace components;
 
+		if (entities.empty())
+		{
+			return;
+		}
+
 		const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
 		const auto& [flow_field] = registry.ctx().get<const navigation::FlowField>();
 
+		const auto prefab = prefab_of(registry, type);
+
 		const auto position = tile_map.coordinate_grid_to_world(point);
 
-		const auto entity = registry.create();
+		const auto first = entities.begin();
+		const auto last = entities.end();
+
+		registry.create(first, last);
 
-		// todo: 加载配置文件
+		// 所有组件按存储批量写入,同一类型的所有实体共享预制体中的值
 
 		// ======================
 		// CORE
@@ -34,41 +111,22 @@ namespace factory
 
 		// transform
 		{
-			registry.emplace<transform::Position>(entity, position);
-			// 图集纹理大小为16*16,放大一些
-			registry.emplace<transform::Scale>(entity, sf::Vector2f{2.f, 2.f});
-			registry.emplace<transform::Rotation>(entity, sf::degrees(0));
+			registry.insert<transform::Position>(first, last, {position});
+			registry.insert<transform::PreviousPosition>(first, last, {position});
+			registry.insert<transform::Scale>(first, last, prefab.scale);
+			registry.insert<transform::Rotation>(first, last, prefab.rotation);
 		}
 		// renderable & sprite_frame
 		{
-			constexpr auto frame_size = sf::Vector2i{16, 16};
-
-			constexpr std::string_view enemy_name{"deep-dive-AntleredRascal"};
-			constexpr entt::basic_hashed_string enemy_hash_name{enemy_name.data(), enemy_name.size()};
-
-			// const auto& texture = helper::Asset::texture_of(registry, enemy_hash_name);
-			registry.emplace<renderable::Texture>(entity, enemy_hash_name);
-			registry.emplace<renderable::Area>(entity, sf::IntRect{{0, 0}, frame_size});
-			registry.emplace<renderable::Origin>(entity, sf::Vector2f{frame_size / 2});
-			registry.emplace<renderable::Color>(entity, sf::Color::White);
-
-			// SpriteFrame
-			registry.emplace<sprite_frame::Timer>(
-				entity,
-				sprite_frame::Timer{.frame_duration = sf::seconds(.25f), .elapsed_time = sf::Time::Zero}
-			);
-			registry.emplace<sprite_frame::Condition>(
-				entity,
-				sprite_frame::Condition{.looping = true, .playing = true}
-			);
-			registry.emplace<sprite_frame::Frame>(
-				entity,
-				sprite_frame::Frame{.total_count = 4, .current_index = 0}
-			);
-			registry.emplace<sprite_frame::Uniform>(
-				entity,
-				sprite_frame::Uniform{.frame_position = {0, 0}, .frame_size = frame_size}
-			);
+			registry.insert<renderable::Texture>(first, last, prefab.texture);
+			registry.insert<renderable::Area>(first, last, prefab.area);
+			registry.insert<renderable::Origin>(first, last, prefab.origin);
+			registry.insert<renderable::Color>(first, last, prefab.color);
+
+			registry.insert<sprite_frame::Timer>(first, last, prefab.timer);
+			registry.insert<sprite_frame::Condition>(first, last, prefab.condition);
+			registry.insert<sprite_frame::Frame>(first, last, prefab.frame);
+			registry.insert<sprite_frame::Uniform>(first, last, prefab.uniform);
 		}
 
 		// ======================
@@ -77,55 +135,70 @@ namespace factory
 
 		// unit
 		{
-			registry.emplace<combat::Type>(entity, type);
-			registry.emplace<combat::Name>(entity, std::format("AntleredRascal #{}", entt::to_integral(entity)));
-			// registry.emplace<combat::OnDeath>(entity, nullptr);
+			registry.insert<combat::Type>(first, last, type);
+			registry.insert<combat::Name>(first, last, helper::Name::intern(registry, prefab.name));
+			// registry.insert<combat::OnDeath>(first, last, {nullptr});
 		}
 		// enemy & health_bar
 		{
-			static std::mt19937 random{std::random_device{}()};
+			registry.insert<enemy::Health>(first, last, prefab.health);
 
-			// 生命值
-			auto& [health] = registry.emplace<enemy::Health>(entity);
-			health = 100;
+			// 地面单位
+			if ((std::to_underlying(prefab.archetype) & std::to_underlying(enemy::Archetype::GROUND)) != 0)
+			{
+				registry.insert<tags::archetype_ground>(first, last);
 
-			// 移动速度
-			auto& [speed] = registry.emplace<enemy::Movement>(entity);
-			speed = 30.f + std::uniform_real_distribution<float>{0, 20}(random);
+				const auto direction = flow_field.direction_of(point);
+				registry.insert<enemy::Direction>(first, last, {direction});
+			}
+			// 空中单位
+			if ((std::to_underlying(prefab.archetype) & std::to_underlying(enemy::Archetype::AERIAL)) != 0)
+			{
+				registry.insert<tags::archetype_aerial>(first, last);
+			}
 
-			// 强度
-			auto& [power] = registry.emplace<enemy::Power>(entity);
-			power = 1 + std::uniform_int_distribution<enemy::Power::value_type>{0, 100}(random);
+			// HealthBar
+			registry.insert<health_bar::Health>(first, last, {prefab.health.health});
+			registry.insert<health_bar::Size>(first, last, prefab.health_bar_size);
+			registry.insert<health_bar::Offset>(first, last, prefab.health_bar_offset);
+		}
 
-			// 地面单位
-			registry.emplace<tags::archetype_ground>(entity);
-			const auto direction = flow_field.direction_of(point);
-			registry.emplace<enemy::Direction>(entity, direction);
+		// 每个实体各不相同的组件(移动速度/强度)
+		{
+			const auto [seed] = registry.ctx().get<const game::Seed>();
+			auto& [spawn_count] = registry.ctx().get<game::SpawnCounter>();
 
-			// HealthBar
+			// 每个敌人使用各自的随机数流(种子 + 生成索引),不共享生成器状态
+			const auto first_spawn = std::exchange(spawn_count, spawn_count + entities.size());
+
+			std::vector<enemy::Movement> movements;
+			std::vector<enemy::Power> powers;
+			movements.reserve(entities.size());
+			powers.reserve(entities.size());
+
+			for (std::size_t i = 0; i < entities.size(); ++i)
 			{
-				const auto& [rect] = registry.get<const renderable::Area>(entity);
-				const auto frame_size = rect.size;
+				utility::Random random{seed, first_spawn + i};
 
-				registry.emplace<health_bar::Health>(entity, health);
-				registry.emplace<health_bar::Size>(entity, sf::Vector2f{static_cast<float>(frame_size.x), static_cast<float>(frame_size.y / 4)}); // NOLINT(bugprone-integer-division)
-				registry.emplace<health_bar::Offset>(entity, sf::Vector2f{static_cast<float>(-frame_size.x / 2), -static_cast<float>(frame_size.y / 2) - 5.f}); // NOLINT(bugprone-integer-division)
+				movements.emplace_back(prefab.movement.speed + random.real(0, prefab.movement_variance));
+				powers.emplace_back(prefab.power.power + random.integer(0, prefab.power_variance));
 			}
+
+			registry.insert<enemy::Movement>(first, last, movements.begin());
+			registry.insert<enemy::Power>(first, last, powers.begin());
 		}
 
 		// 初始化完成后才注册该标记,如此方便获取设置的实体信息
-		registry.emplace<tags::enemy>(entity);
-
-		return entity;
+		registry.insert<tags::enemy>(first, last);
 	}
 
-	auto enemy(entt::registry& registry, const std::uint32_t start_gate_id, const components::combat::Type type) noexcept -> entt::entity
+	auto enemy(entt::registry& registry, const std::uint32_t start_gate_id, const components::combat::Type type, const std::span<entt::entity> entities) noexcept -> void
 	{
 		using namespace components;
 
 		const auto& [start_gates] = registry.ctx().get<const map_ex::StartGate>();
 		const auto start_gate = start_gates[start_gate_id];
 
-		return enemy(registry, start_gate, type);
+		enemy(registry, start_gate, type, entities);
 	}
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include <components/combat/unit.hpp>
 
 #include <entt/fwd.hpp>
@@ -13,4 +15,10 @@ namespace factory
 
 	// 生成敌人(指定出生点)
 	auto enemy(entt::registry& registry, std::uint32_t start_gate_id, components::combat::Type type) noexcept -> entt::entity;
+
+	// 批量生成同一类型的敌人(指定位置),生成的实体写入entities
+	auto enemy(entt::registry& registry, sf::Vector2u point, components::combat::Type type, std::span<entt::entity> entities) noexcept -> void;
+
+	// 批量生成同一类型的敌人(指定出生点),生成的实体写入entities
+	auto enemy(entt::registry& registry, std::uint32_t start_gate_id, components::combat::Type type, std::span<entt::entity> entities) noexcept -> void;
 }
@@ -0,0 +1,139 @@
+#include <graphics/atlas.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+
+#include <utility/mapped_file.hpp>
+#include <utility/write_file.hpp>
+
+#include <entt/core/hashed_string.hpp>
+
+namespace
+{
+	using namespace graphics;
+
+	static_assert(std::is_trivially_copyable_v<Atlas::Header> and std::is_standard_layout_v<Atlas::Header>);
+	static_assert(std::is_trivially_copyable_v<Atlas::Page> and std::is_standard_layout_v<Atlas::Page>);
+	static_assert(std::is_trivially_copyable_v<Atlas::Entry> and std::is_standard_layout_v<Atlas::Entry>);
+}
+
+namespace graphics
+{
+	Atlas::Atlas(std::vector<Page> pages, std::vector<Entry> entries) noexcept
+		: pages_{std::move(pages)},
+		  entries_{std::move(entries)}
+	{
+		std::ranges::sort(entries_, std::ranges::less{}, &Entry::texture);
+	}
+
+	auto Atlas::page_name(const std::size_t index) noexcept -> std::string
+	{
+		return std::format("atlas{}", index);
+	}
+
+	auto Atlas::page_id(const std::size_t index) noexcept -> entt::id_type
+	{
+		const auto name = page_name(index);
+
+		return entt::hashed_string::value(name.data(), name.size());
+	}
+
+	auto Atlas::write(const std::filesystem::path& path) const noexcept -> bool
+	{
+		const Header header
+		{
+				.magic = magic,
+				.version = version,
+				.page_count = static_cast<std::uint32_t>(pages_.size()),
+				.entry_count = static_cast<std::uint32_t>(entries_.size()),
+		};
+
+		return utility::write_file(
+			path,
+			[&](std::ostream& out) noexcept -> bool
+			{
+				out.write(reinterpret_cast<const char*>(&header), sizeof(Header)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+				out.write(reinterpret_cast<const char*>(pages_.data()), static_cast<std::streamsize>(pages_.size() * sizeof(Page))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+				out.write(reinterpret_cast<const char*>(entries_.data()), static_cast<std::streamsize>(entries_.size() * sizeof(Entry))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+				return not out.fail();
+			}
+		);
+	}
+
+	auto Atlas::read(const std::filesystem::path& path) noexcept -> std::optional<Atlas>
+	{
+		const auto file = utility::MappedFile::open(path);
+		if (not file.has_value())
+		{
+			return std::nullopt;
+		}
+
+		const auto bytes = file->bytes();
+		if (bytes.size() < sizeof(Header))
+		{
+			return std::nullopt;
+		}
+
+		Header header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		std::memcpy(&header, bytes.data(), sizeof(Header));
+
+		if (header.magic != magic or header.version != version)
+		{
+			return std::nullopt;
+		}
+
+		const auto page_size = static_cast<std::size_t>(header.page_count) * sizeof(Page);
+		const auto entry_size = static_cast<std::size_t>(header.entry_count) * sizeof(Entry);
+		if (bytes.size() != sizeof(Header) + page_size + entry_size)
+		{
+			return std::nullopt;
+		}
+
+		std::vector<Page> pages(header.page_count);
+		std::memcpy(pages.data(), bytes.data() + sizeof(Header), page_size);
+
+		std::vector<Entry> entries(header.entry_count);
+		std::memcpy(entries.data(), bytes.data() + sizeof(Header) + page_size, entry_size);
+
+		// 所有条目都必须引用已知的页
+		const auto valid = std::ranges::all_of(
+			entries,
+			[&](const Entry& entry) noexcept -> bool
+			{
+				return std::ranges::contains(pages, entry.page, &Page::id);
+			}
+		);
+		if (not valid)
+		{
+			return std::nullopt;
+		}
+
+		return Atlas{std::move(pages), std::move(entries)};
+	}
+
+	auto Atlas::find(const entt::id_type texture) const noexcept -> const Entry*
+	{
+		const auto it = std::ranges::lower_bound(entries_, texture, std::ranges::less{}, &Entry::texture);
+		if (it == entries_.end() or it->texture != texture)
+		{
+			return nullptr;
+		}
+
+		return std::to_address(it);
+	}
+
+	auto Atlas::remap(entt::id_type& texture, sf::IntRect& area) const noexcept -> void
+	{
+		const auto* entry = find(texture);
+		if (entry == nullptr)
+		{
+			return;
+		}
+
+		texture = entry->page;
+		area.position.x += entry->x;
+		area.position.y += entry->y;
+	}
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <entt/core/fwd.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+namespace graphics
+{
+	// 纹理图集查找表(由td_atlas离线生成)
+	// 记录每个源纹理位于哪一页以及在页中的偏移,渲染时将(纹理ID, 区域)映射为(图集页ID, 区域)
+	// [Header][Page...][Entry...]
+	class Atlas
+	{
+	public:
+		// "TDAT"
+		constexpr static std::uint32_t magic = 0x5441'4454;
+		// 文件布局发生变化时递增
+		constexpr static std::uint32_t version = 1;
+
+		// 查找表文件名(位于图集纹理目录中)
+		constexpr static std::string_view filename = "atlas.tdatlas";
+
+		class Header
+		{
+		public:
+			std::uint32_t magic;
+			std::uint32_t version;
+
+			std::uint32_t page_count;
+			std::uint32_t entry_count;
+		};
+
+		class Page
+		{
+		public:
+			// 纹理ID(hash(page_name(index)))
+			entt::id_type id;
+
+			std::uint32_t width;
+			std::uint32_t height;
+			std::uint32_t reserved;
+		};
+
+		class Entry
+		{
+		public:
+			// 源纹理ID
+			entt::id_type texture;
+			// 所在页的纹理ID
+			entt::id_type page;
+
+			// 源纹理在页中的位置
+			std::int32_t x;
+			std::int32_t y;
+			std::uint32_t width;
+			std::uint32_t height;
+		};
+
+	private:
+		std::vector<Page> pages_;
+		// 按源纹理ID排序
+		std::vector<Entry> entries_;
+
+	public:
+		Atlas(std::vector<Page> pages, std::vector<Entry> entries) noexcept;
+
+		// 第index页的名称(不含扩展名)
+		[[nodiscard]] static auto page_name(std::size_t index) noexcept -> std::string;
+
+		// 第index页的纹理ID
+		[[nodiscard]] static auto page_id(std::size_t index) noexcept -> entt::id_type;
+
+		// 写入查找表
+		[[nodiscard]] auto write(const std::filesystem::path& path) const noexcept -> bool;
+
+		// 读取查找表,文件无效(或版本不匹配)时返回nullopt
+		[[nodiscard]] static auto read(const std::filesystem::path& path) noexcept -> std::optional<Atlas>;
+
+		[[nodiscard]] auto pages() const noexcept -> std::span<const Page>
+		{
+			return pages_;
+		}
+
+		[[nodiscard]] auto entries() const noexcept -> std::span<const Entry>
+		{
+			return entries_;
+		}
+
+		// 查找源纹理,不在图集中时返回nullptr
+		[[nodiscard]] auto find(entt::id_type texture) const noexcept -> const Entry*;
+
+		// 将源纹理中的区域映射到图集页,不在图集中时保持不变
+		auto remap(entt::id_type& texture, sf::IntRect& area) const noexcept -> void;
+	};
+}
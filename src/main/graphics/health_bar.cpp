@@ -0,0 +1,35 @@
+#include <graphics/health_bar.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+
+namespace graphics
+{
+	auto HealthBar::generate(const sf::Vector2f position, const sf::Vector2f size, const float ratio, const std::span<sf::Vertex, vertices_per_bar> vertices) noexcept -> void
+	{
+		// 血条颜色
+		constexpr auto hb_color = sf::Color::Red;
+		const auto h_color = ratio > .6f ? sf::Color::Green : sf::Color::Yellow;
+
+		const auto h_size = sf::Vector2f{size.x * ratio, size.y};
+
+		// 背景矩形
+
+		vertices[0] = {.position = position, .color = hb_color, .texCoords = {}};
+		vertices[1] = {.position = position + sf::Vector2f{size.x, 0}, .color = hb_color, .texCoords = {}};
+		vertices[2] = {.position = position + size, .color = hb_color, .texCoords = {}};
+
+		vertices[3] = {.position = position, .color = hb_color, .texCoords = {}};
+		vertices[4] = {.position = position + size, .color = hb_color, .texCoords = {}};
+		vertices[5] = {.position = position + sf::Vector2f{0, size.y}, .color = hb_color, .texCoords = {}};
+
+		// 血条矩形
+
+		vertices[6] = {.position = position, .color = h_color, .texCoords = {}};
+		vertices[7] = {.position = position + sf::Vector2f{h_size.x, 0}, .color = h_color, .texCoords = {}};
+		vertices[8] = {.position = position + h_size, .color = h_color, .texCoords = {}};
+
+		vertices[9] = {.position = position, .color = h_color, .texCoords = {}};
+		vertices[10] = {.position = position + h_size, .color = h_color, .texCoords = {}};
+		vertices[11] = {.position = position + sf::Vector2f{0, h_size.y}, .color = h_color, .texCoords = {}};
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <span>
+
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace graphics
+{
+	class HealthBar
+	{
+	public:
+		// 2个矩形(背景+血条) * 6个顶点(每个矩形2个三角形)
+		constexpr static std::size_t vertices_per_bar = 12;
+
+		// 生成单个血条的顶点(Triangles)
+		// position: 血条左上角位置
+		// ratio: 当前血量 / 满血血量
+		static auto generate(sf::Vector2f position, sf::Vector2f size, float ratio, std::span<sf::Vertex, vertices_per_bar> vertices) noexcept -> void;
+	};
+}
@@ -0,0 +1,123 @@
+#include <graphics/skyline_packer.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace graphics
+{
+	SkylinePacker::SkylinePacker(const sf::Vector2u size) noexcept
+		: size_{size},
+		  skyline_{{.x = 0, .y = 0, .width = size.x}},
+		  used_area_{0} {}
+
+	auto SkylinePacker::fit(const std::size_t index, const sf::Vector2u size) const noexcept -> std::optional<std::uint32_t>
+	{
+		const auto x = skyline_[index].x;
+		if (x + size.x > size_.x)
+		{
+			return std::nullopt;
+		}
+
+		// 矩形覆盖的所有节点中最高的位置
+		std::uint32_t y = 0;
+		std::uint32_t remaining = size.x;
+		for (auto i = index; remaining > 0; ++i)
+		{
+			y = std::ranges::max(y, skyline_[i].y);
+			if (y + size.y > size_.y)
+			{
+				return std::nullopt;
+			}
+
+			remaining -= std::ranges::min(remaining, skyline_[i].width);
+		}
+
+		return y;
+	}
+
+	auto SkylinePacker::insert(const sf::Vector2u size) noexcept -> std::optional<sf::Vector2u>
+	{
+		if (size.x == 0 or size.y == 0)
+		{
+			return std::nullopt;
+		}
+
+		// 顶部最低的位置(相同时选择节点更窄的位置,减少浪费)
+		auto best_index = skyline_.size();
+		auto best_top = std::numeric_limits<std::uint32_t>::max();
+		auto best_width = std::numeric_limits<std::uint32_t>::max();
+		std::uint32_t best_y = 0;
+
+		for (std::size_t i = 0; i < skyline_.size(); ++i)
+		{
+			const auto y = fit(i, size);
+			if (not y.has_value())
+			{
+				continue;
+			}
+
+			const auto top = *y + size.y;
+			if (top < best_top or (top == best_top and skyline_[i].width < best_width))
+			{
+				best_index = i;
+				best_top = top;
+				best_width = skyline_[i].width;
+				best_y = *y;
+			}
+		}
+
+		if (best_index == skyline_.size())
+		{
+			return std::nullopt;
+		}
+
+		const sf::Vector2u position{skyline_[best_index].x, best_y};
+
+		// 插入新节点,并裁剪被其覆盖的节点
+		skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(best_index), {.x = position.x, .y = best_top, .width = size.x});
+
+		const auto right = position.x + size.x;
+		for (auto i = best_index + 1; i < skyline_.size();)
+		{
+			auto& node = skyline_[i];
+			if (node.x >= right)
+			{
+				break;
+			}
+
+			const auto node_right = node.x + node.width;
+			if (node_right <= right)
+			{
+				skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i));
+				continue;
+			}
+
+			node.width = node_right - right;
+			node.x = right;
+			break;
+		}
+
+		// 合并相同高度的相邻节点
+		for (std::size_t i = 0; i + 1 < skyline_.size();)
+		{
+			if (skyline_[i].y == skyline_[i + 1].y)
+			{
+				skyline_[i].width += skyline_[i + 1].width;
+				skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+				continue;
+			}
+
+			i += 1;
+		}
+
+		used_area_ += static_cast<std::uint64_t>(size.x) * size.y;
+		return position;
+	}
+
+	auto SkylinePacker::occupancy() const noexcept -> float
+	{
+		const auto area = static_cast<std::uint64_t>(size_.x) * size_.y;
+
+		return area == 0 ? 0.f : static_cast<float>(static_cast<double>(used_area_) / static_cast<double>(area));
+	}
+}
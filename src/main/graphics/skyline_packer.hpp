@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace graphics
+{
+	// 天际线矩形装箱(bottom-left)
+	// 维护每一列已占用的最高位置,新矩形放在使其顶部最低的位置
+	class SkylinePacker
+	{
+		class Node
+		{
+		public:
+			std::uint32_t x;
+			std::uint32_t y;
+			std::uint32_t width;
+		};
+
+		sf::Vector2u size_;
+		std::vector<Node> skyline_;
+
+		std::uint64_t used_area_;
+
+		// 以第index个节点为左边界放置矩形时矩形的y坐标,放不下时返回nullopt
+		[[nodiscard]] auto fit(std::size_t index, sf::Vector2u size) const noexcept -> std::optional<std::uint32_t>;
+
+	public:
+		explicit SkylinePacker(sf::Vector2u size) noexcept;
+
+		// 放置矩形,返回其左上角位置,放不下时返回nullopt
+		[[nodiscard]] auto insert(sf::Vector2u size) noexcept -> std::optional<sf::Vector2u>;
+
+		[[nodiscard]] auto size() const noexcept -> sf::Vector2u
+		{
+			return size_;
+		}
+
+		// 已使用的面积占比
+		[[nodiscard]] auto occupancy() const noexcept -> float;
+	};
+}
@@ -0,0 +1,82 @@
+#include <graphics/spatial_grid.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <entt/entity/entity.hpp>
+
+namespace graphics
+{
+	SpatialGrid::SpatialGrid() noexcept
+		: bounds_{},
+		  cell_size_{1},
+		  columns_{0},
+		  rows_{0},
+		  max_extent_{0} {}
+
+	auto SpatialGrid::column_of(const float x) const noexcept -> std::uint32_t
+	{
+		const auto column = std::floor((x - bounds_.position.x) / cell_size_);
+
+		return static_cast<std::uint32_t>(std::ranges::clamp(column, 0.f, static_cast<float>(columns_ - 1)));
+	}
+
+	auto SpatialGrid::row_of(const float y) const noexcept -> std::uint32_t
+	{
+		const auto row = std::floor((y - bounds_.position.y) / cell_size_);
+
+		return static_cast<std::uint32_t>(std::ranges::clamp(row, 0.f, static_cast<float>(rows_ - 1)));
+	}
+
+	auto SpatialGrid::reset(const sf::FloatRect& bounds, const float cell_size) noexcept -> void
+	{
+		bounds_ = bounds;
+		cell_size_ = std::ranges::max(cell_size, 1.f);
+
+		columns_ = std::ranges::max(static_cast<std::uint32_t>(std::ceil(bounds.size.x / cell_size_)), 1u);
+		rows_ = std::ranges::max(static_cast<std::uint32_t>(std::ceil(bounds.size.y / cell_size_)), 1u);
+
+		// 只清空,不释放
+		cells_.resize(static_cast<std::size_t>(columns_) * rows_);
+		for (auto& cell: cells_)
+		{
+			cell.clear();
+		}
+
+		max_extent_ = 0;
+	}
+
+	auto SpatialGrid::insert(const entt::entity entity, const sf::Vector2f center, const float extent) noexcept -> void
+	{
+		const auto column = column_of(center.x);
+		const auto row = row_of(center.y);
+
+		cells_[static_cast<std::size_t>(row) * columns_ + column].push_back(entity);
+
+		max_extent_ = std::ranges::max(max_extent_, extent);
+	}
+
+	auto SpatialGrid::query(const sf::FloatRect& area, std::vector<entt::entity>& out) const noexcept -> void
+	{
+		if (cells_.empty())
+		{
+			return;
+		}
+
+		// 中心点在扩展范围内的实体才可能与area相交
+		const auto first_column = column_of(area.position.x - max_extent_);
+		const auto last_column = column_of(area.position.x + area.size.x + max_extent_);
+		const auto first_row = row_of(area.position.y - max_extent_);
+		const auto last_row = row_of(area.position.y + area.size.y + max_extent_);
+
+		for (auto row = first_row; row <= last_row; ++row)
+		{
+			for (auto column = first_column; column <= last_column; ++column)
+			{
+				const auto& cell = cells_[static_cast<std::size_t>(row) * columns_ + column];
+
+				out.insert(out.end(), cell.begin(), cell.end());
+			}
+		}
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <entt/entity/fwd.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace graphics
+{
+	// 渲染用的粗粒度空间网格
+	// 每帧重新填充(保留已分配的内存),实体按中心点放入单个网格,查询时按最大半径扩展查询范围
+	class SpatialGrid
+	{
+		sf::FloatRect bounds_;
+		float cell_size_;
+
+		std::uint32_t columns_;
+		std::uint32_t rows_;
+
+		std::vector<std::vector<entt::entity>> cells_;
+
+		// 已插入实体的最大半径
+		float max_extent_;
+
+		[[nodiscard]] auto column_of(float x) const noexcept -> std::uint32_t;
+		[[nodiscard]] auto row_of(float y) const noexcept -> std::uint32_t;
+
+	public:
+		SpatialGrid() noexcept;
+
+		// 清空网格,bounds以外的实体放入边缘网格
+		auto reset(const sf::FloatRect& bounds, float cell_size) noexcept -> void;
+
+		// extent: 实体在任意方向上到中心点的最大距离
+		auto insert(entt::entity entity, sf::Vector2f center, float extent) noexcept -> void;
+
+		// 将可能与area相交的实体追加到out(粗略结果,可能包含area外的实体)
+		auto query(const sf::FloatRect& area, std::vector<entt::entity>& out) const noexcept -> void;
+	};
+}
@@ -0,0 +1,137 @@
+#include <graphics/sprite_batch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <graphics/atlas.hpp>
+
+#include <utility/thread_pool.hpp>
+
+namespace
+{
+	// 每个任务处理的精灵数量
+	constexpr std::size_t sprite_grain = 1024;
+}
+
+namespace graphics
+{
+	auto SpriteBatch::clear() noexcept -> void
+	{
+		sprites_.clear();
+		order_.clear();
+		vertices_.clear();
+		batches_.clear();
+	}
+
+	auto SpriteBatch::reserve(const std::size_t count) noexcept -> void
+	{
+		sprites_.reserve(count);
+		order_.reserve(count);
+		vertices_.reserve(count * vertices_per_sprite);
+	}
+
+	auto SpriteBatch::set_atlas(const Atlas* atlas) noexcept -> void
+	{
+		atlas_ = atlas;
+	}
+
+	auto SpriteBatch::add(const Sprite& sprite) noexcept -> void
+	{
+		auto& added = sprites_.emplace_back(sprite);
+
+		if (atlas_ != nullptr)
+		{
+			atlas_->remap(added.texture, added.area);
+		}
+	}
+
+	auto SpriteBatch::build(const bool parallel) noexcept -> void
+	{
+		// 按纹理排序(稳定排序保证同一纹理的精灵保持添加顺序)
+		order_.resize(sprites_.size());
+		std::iota(order_.begin(), order_.end(), std::uint32_t{0});
+		std::ranges::stable_sort(
+			order_,
+			std::ranges::less{},
+			[this](const std::uint32_t index) noexcept -> entt::id_type
+			{
+				return sprites_[index].texture;
+			}
+		);
+
+		// 划分批次
+		batches_.clear();
+		for (std::size_t i = 0; i < order_.size(); ++i)
+		{
+			const auto texture = sprites_[order_[i]].texture;
+
+			if (batches_.empty() or batches_.back().texture != texture)
+			{
+				batches_.emplace_back(texture, i * vertices_per_sprite, 0);
+			}
+			batches_.back().count += vertices_per_sprite;
+		}
+
+		// 生成顶点
+		vertices_.resize(sprites_.size() * vertices_per_sprite);
+
+		const auto fill = [this](const std::size_t begin, const std::size_t end) noexcept -> void
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				generate(sprites_[order_[i]], std::span{vertices_}.subspan(i * vertices_per_sprite).first<vertices_per_sprite>());
+			}
+		};
+
+		if (parallel)
+		{
+			utility::ThreadPool::global().parallel_for(order_.size(), sprite_grain, fill);
+		}
+		else
+		{
+			fill(0, order_.size());
+		}
+	}
+
+	auto SpriteBatch::generate(const Sprite& sprite, const std::span<sf::Vertex, vertices_per_sprite> vertices) noexcept -> void
+	{
+		// 与 translate(position) * scale(scale) * rotate(rotation) * translate(-origin) 相同
+		const auto radians = sprite.rotation.asRadians();
+		const auto cos = std::cos(radians);
+		const auto sin = std::sin(radians);
+
+		const auto transform = [&](const float x, const float y) noexcept -> sf::Vector2f
+		{
+			const auto local_x = x - sprite.origin.x;
+			const auto local_y = y - sprite.origin.y;
+
+			return
+			{
+					sprite.position.x + (local_x * cos - local_y * sin) * sprite.scale.x,
+					sprite.position.y + (local_x * sin + local_y * cos) * sprite.scale.y
+			};
+		};
+
+		const auto rect = sf::FloatRect{sprite.area};
+		const auto width = rect.size.x;
+		const auto height = rect.size.y;
+
+		const auto left = rect.position.x;
+		const auto top = rect.position.y;
+		const auto right = left + width;
+		const auto bottom = top + height;
+
+		const auto top_left = sf::Vertex{.position = transform(0, 0), .color = sprite.color, .texCoords = {left, top}};
+		const auto top_right = sf::Vertex{.position = transform(width, 0), .color = sprite.color, .texCoords = {right, top}};
+		const auto bottom_left = sf::Vertex{.position = transform(0, height), .color = sprite.color, .texCoords = {left, bottom}};
+		const auto bottom_right = sf::Vertex{.position = transform(width, height), .color = sprite.color, .texCoords = {right, bottom}};
+
+		vertices[0] = top_left;
+		vertices[1] = top_right;
+		vertices[2] = bottom_left;
+		vertices[3] = top_right;
+		vertices[4] = bottom_right;
+		vertices[5] = bottom_left;
+	}
+}
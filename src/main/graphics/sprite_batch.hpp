@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <entt/core/fwd.hpp>
+
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/System/Angle.hpp>
+
+namespace graphics
+{
+	class Atlas;
+
+	// 精灵批处理
+	// 在CPU上完成顶点变换,同一纹理的所有精灵合并为一个批次(一次draw)
+	// 所有缓冲区在帧之间复用,不会每帧分配
+	class SpriteBatch
+	{
+	public:
+		// 每个精灵2个三角形
+		constexpr static std::size_t vertices_per_sprite = 6;
+
+		class Sprite
+		{
+		public:
+			entt::id_type texture;
+
+			sf::Vector2f position;
+			sf::Vector2f scale;
+			sf::Angle rotation;
+			sf::Vector2f origin;
+
+			sf::IntRect area;
+			sf::Color color;
+		};
+
+		// 一个批次(vertices中[first, first + count)的顶点使用同一纹理)
+		class Batch
+		{
+		public:
+			entt::id_type texture;
+
+			std::size_t first;
+			std::size_t count;
+		};
+
+	private:
+		// 存在时将源纹理映射到图集页,使不同源纹理的精灵可以合并为一个批次
+		const Atlas* atlas_ = nullptr;
+
+		std::vector<Sprite> sprites_;
+		// 按纹理排序后的精灵索引
+		std::vector<std::uint32_t> order_;
+
+		std::vector<sf::Vertex> vertices_;
+		std::vector<Batch> batches_;
+
+	public:
+		// 开始新的一帧(保留已分配的内存)
+		auto clear() noexcept -> void;
+
+		auto reserve(std::size_t count) noexcept -> void;
+
+		// 设置纹理图集(nullptr表示不使用图集),之后添加的精灵生效
+		auto set_atlas(const Atlas* atlas) noexcept -> void;
+
+		auto add(const Sprite& sprite) noexcept -> void;
+
+		// 按纹理排序并生成所有顶点
+		// parallel: 是否使用线程池并行生成顶点(每个精灵写入各自的顶点范围)
+		auto build(bool parallel = true) noexcept -> void;
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t
+		{
+			return sprites_.size();
+		}
+
+		[[nodiscard]] auto vertices() const noexcept -> std::span<const sf::Vertex>
+		{
+			return vertices_;
+		}
+
+		[[nodiscard]] auto batches() const noexcept -> std::span<const Batch>
+		{
+			return batches_;
+		}
+
+		// 生成单个精灵的顶点(Triangles)
+		static auto generate(const Sprite& sprite, std::span<sf::Vertex, vertices_per_sprite> vertices) noexcept -> void;
+	};
+}
@@ -38,8 +38,7 @@ namespace helper
 
 		const auto& [sounds] = registry.ctx().get<asset::Sounds>();
 
-		// todo: 如果不存在则返回默认音效
-		assert(sounds.contains(id));
+		// 预加载时解码失败的音效不会加入缓存,此时返回空句柄
 		const auto sound = sounds[id];
 
 		return sound;
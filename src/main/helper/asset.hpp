@@ -26,7 +26,7 @@ namespace helper
 		// 获取指定ID纹理,保证不为空(如果不存在则返回默认纹理)
 		[[nodiscard]] static auto texture_of(entt::registry& registry, entt::id_type id) noexcept -> entt::resource<const sf::Texture>;
 
-		// 获取指定ID音效,保证不为空(如果不存在则返回默认音效)
+		// 获取指定ID音效,音效解码失败(不存在)时返回空句柄
 		[[nodiscard]] static auto sound_of(entt::registry& registry, entt::id_type id) noexcept -> entt::resource<const loaders::SoundResource>;
 	};
 }
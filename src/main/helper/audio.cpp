@@ -0,0 +1,21 @@
+#include <helper/audio.hpp>
+
+#include <components/core/audio.hpp>
+
+#include <entt/entt.hpp>
+
+namespace helper
+{
+	auto Audio::emit(entt::registry& registry, const entt::id_type sound, const sf::Vector2f position) noexcept -> void
+	{
+		using namespace components;
+
+		auto* emissions = registry.ctx().find<audio::Emissions>();
+		if (emissions == nullptr)
+		{
+			return;
+		}
+
+		emissions->emissions.emplace_back(sound, position);
+	}
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace helper
+{
+	class Audio
+	{
+	public:
+		// 在指定位置播放音效(本帧结束时由update::audio统一处理)
+		// 没有audio::Emissions时(例如无界面模拟)忽略
+		static auto emit(entt::registry& registry, entt::id_type sound, sf::Vector2f position) noexcept -> void;
+	};
+}
@@ -0,0 +1,77 @@
+#include <helper/camera.hpp>
+
+#include <algorithm>
+
+#include <components/core/camera.hpp>
+#include <components/map/map.hpp>
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+
+namespace
+{
+	// 视图中心不能离开地图
+	auto clamp_center(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+		auto& [center, zoom, viewport] = registry.ctx().get<camera::Camera>();
+
+		const auto map_bounds = tile_map.map_bounds<float>();
+
+		center.x = std::ranges::clamp(center.x, map_bounds.position.x, map_bounds.position.x + map_bounds.size.x);
+		center.y = std::ranges::clamp(center.y, map_bounds.position.y, map_bounds.position.y + map_bounds.size.y);
+	}
+}
+
+namespace helper
+{
+	auto Camera::apply(entt::registry& registry, sf::RenderWindow& window) noexcept -> void
+	{
+		using namespace components;
+
+		auto& [center, zoom, viewport] = registry.ctx().get<camera::Camera>();
+
+		viewport = sf::Vector2f{window.getSize()};
+
+		window.setView(sf::View{center, viewport * zoom});
+	}
+
+	auto Camera::pixel_to_world(const entt::registry& registry, const sf::Vector2i pixel) noexcept -> sf::Vector2f
+	{
+		using namespace components;
+
+		const auto [center, zoom, viewport] = registry.ctx().get<const camera::Camera>();
+
+		return center + (sf::Vector2f{pixel} - viewport * .5f) * zoom;
+	}
+
+	auto Camera::move(entt::registry& registry, const sf::Vector2f offset) noexcept -> void
+	{
+		using namespace components;
+
+		auto& [center, zoom, viewport] = registry.ctx().get<camera::Camera>();
+
+		center += offset;
+
+		clamp_center(registry);
+	}
+
+	auto Camera::zoom(entt::registry& registry, const float factor, const sf::Vector2i pixel) noexcept -> void
+	{
+		using namespace components;
+
+		// 缩放前后pixel处对应的世界坐标不变
+		const auto anchor = pixel_to_world(registry, pixel);
+
+		auto& [center, zoom, viewport] = registry.ctx().get<camera::Camera>();
+
+		const auto new_zoom = std::ranges::clamp(zoom * factor, min_zoom, max_zoom);
+
+		center = anchor + (center - anchor) * (new_zoom / zoom);
+		zoom = new_zoom;
+
+		clamp_center(registry);
+	}
+}
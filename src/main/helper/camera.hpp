@@ -0,0 +1,32 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace sf
+{
+	class RenderWindow;
+}
+
+namespace helper
+{
+	class Camera
+	{
+	public:
+		constexpr static float min_zoom = .25f;
+		constexpr static float max_zoom = 4.f;
+
+		// 将相机视图应用到窗口(同时更新视口大小)
+		static auto apply(entt::registry& registry, sf::RenderWindow& window) noexcept -> void;
+
+		// 窗口像素坐标 => 世界坐标
+		[[nodiscard]] static auto pixel_to_world(const entt::registry& registry, sf::Vector2i pixel) noexcept -> sf::Vector2f;
+
+		// 平移视图(世界坐标)
+		static auto move(entt::registry& registry, sf::Vector2f offset) noexcept -> void;
+
+		// 以pixel处为中心缩放视图(factor > 1 放大可视范围)
+		static auto zoom(entt::registry& registry, float factor, sf::Vector2i pixel) noexcept -> void;
+	};
+}
@@ -1,12 +1,15 @@
 #include <helper/enemy.hpp>
 
-#include <print>
+#include <utility>
 
 #include <components/core/tags.hpp>
 #include <components/combat/unit.hpp>
 #include <components/combat/enemy.hpp>
+#include <components/game/game.hpp>
 
-#include <utility/time.hpp>
+#include <helper/name.hpp>
+
+#include <logger/logger.hpp>
 
 #include <entt/entt.hpp>
 
@@ -18,8 +21,10 @@ namespace helper
 
 		assert(registry.all_of<tags::enemy>(enemy));
 
-		registry.emplace<tags::dead>(enemy);
-		registry.emplace<tags::cod_reached>(enemy);
+		// 可能在并行系统中调用,延迟到同步点执行
+		auto& [commands] = registry.ctx().get<game::Commands>();
+		commands.emplace<tags::dead>(enemy);
+		commands.emplace<tags::cod_reached>(enemy);
 	}
 
 	auto Enemy::kill(entt::registry& registry, const entt::entity attacker, const entt::entity victim) noexcept -> void
@@ -30,15 +35,14 @@ namespace helper
 		assert(registry.valid(victim));
 		assert(registry.all_of<tags::enemy>(victim));
 
-		const auto& [attacker_name] = registry.get<const combat::Name>(attacker);
-		const auto& [victim_name] = registry.get<const combat::Name>(victim);
+		const auto attacker_name = Name::name_of(registry, attacker);
+		const auto victim_name = Name::name_of(registry, victim);
 
 		// 如果目标已经死亡则什么也不做
 		if (registry.all_of<tags::dead>(victim))
 		{
-			std::println(
-				"[{:%Y-%m-%d %H:%M:%S}] [{}](EID:{})试图击杀[{}](EID:{}),但是其已死亡",
-				utility::zoned_now(),
+			logger::debug(
+				"[{}](EID:{})试图击杀[{}](EID:{}),但是其已死亡",
 				attacker_name,
 				std::to_underlying(attacker),
 				victim_name,
@@ -47,9 +51,8 @@ namespace helper
 			return;
 		}
 
-		std::println(
-			"[{:%Y-%m-%d %H:%M:%S}] [{}](EID:{})击杀[{}](EID:{})",
-			utility::zoned_now(),
+		logger::info(
+			"[{}](EID:{})击杀[{}](EID:{})",
 			attacker_name,
 			std::to_underlying(attacker),
 			victim_name,
@@ -68,15 +71,14 @@ namespace helper
 		assert(registry.valid(victim));
 		assert(registry.all_of<tags::enemy>(victim));
 
-		const auto& [attacker_name] = registry.get<const combat::Name>(attacker);
-		const auto& [victim_name] = registry.get<const combat::Name>(victim);
+		const auto attacker_name = Name::name_of(registry, attacker);
+		const auto victim_name = Name::name_of(registry, victim);
 
 		// 如果目标已经死亡则什么也不做
 		if (registry.all_of<tags::dead>(victim))
 		{
-			std::println(
-				"[{:%Y-%m-%d %H:%M:%S}] [{}](EID:{})试图伤害[{}](EID:{}),但是其已死亡",
-				utility::zoned_now(),
+			logger::debug(
+				"[{}](EID:{})试图伤害[{}](EID:{}),但是其已死亡",
 				attacker_name,
 				std::to_underlying(attacker),
 				victim_name,
@@ -90,9 +92,8 @@ namespace helper
 		const auto new_health = health - damage;
 		const auto old_health = std::exchange(health, new_health);
 
-		std::println(
-			"[{:%Y-%m-%d %H:%M:%S}] [{}](EID:{})对[{}](EID:{})造成了{:.3f}点伤害({:.3f} ==> {:.3f})",
-			utility::zoned_now(),
+		logger::debug(
+			"[{}](EID:{})对[{}](EID:{})造成了{:.3f}点伤害({:.3f} ==> {:.3f})",
 			attacker_name,
 			std::to_underlying(attacker),
 			victim_name,
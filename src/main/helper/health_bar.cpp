@@ -0,0 +1,97 @@
+#include <helper/health_bar.hpp>
+
+#include <span>
+
+#include <components/core/tags.hpp>
+#include <components/core/transform.hpp>
+#include <components/core/camera.hpp>
+#include <components/combat/enemy.hpp>
+#include <components/combat/health_bar.hpp>
+
+#include <graphics/health_bar.hpp>
+
+#include <helper/transform.hpp>
+
+#include <utility/thread_pool.hpp>
+
+#include <entt/entt.hpp>
+
+namespace
+{
+	// 每个任务处理的血条数量
+	constexpr std::size_t health_bar_grain = 1024;
+}
+
+namespace helper
+{
+	auto HealthBar::build(entt::registry& registry) noexcept -> std::size_t
+	{
+		using namespace components;
+
+		const auto [hide_full_health] = registry.ctx().get<const health_bar::Options>();
+		auto& [enemies, vertices] = registry.ctx().get<health_bar::Buffer>();
+		// 只绘制视图内敌人的血条
+		const auto& [bounds, grid, visible_entities] = registry.ctx().get<const camera::Visible>();
+
+		const auto enemy_view = registry.view<
+			const enemy::Health,
+			const health_bar::Health,
+			const health_bar::Size,
+			const health_bar::Offset,
+			const transform::Position>(entt::exclude<tags::dead>);
+
+		// 先收集实际需要绘制的敌人
+		enemies.clear();
+		for (const auto entity: visible_entities)
+		{
+			if (not enemy_view.contains(entity))
+			{
+				continue;
+			}
+
+			const auto [current_health, max_health, hb_size, hb_offset, position] = enemy_view.get(entity);
+			if (hide_full_health and current_health.health >= max_health.health)
+			{
+				continue;
+			}
+
+			enemies.push_back(entity);
+		}
+
+		const auto vertex_count = enemies.size() * graphics::HealthBar::vertices_per_bar;
+		// 只扩容,不缩容
+		if (vertices.size() < vertex_count)
+		{
+			vertices.resize(vertex_count);
+		}
+
+		// 每个敌人写入各自的顶点范围,可以并行生成
+		const auto& const_registry = registry;
+		utility::ThreadPool::global().parallel_for(
+			enemies.size(),
+			health_bar_grain,
+			[&](const std::size_t begin, const std::size_t end) noexcept -> void
+			{
+				for (auto i = begin; i < end; ++i)
+				{
+					const auto entity = enemies[i];
+
+					const auto [current_health, max_health, hb_size, hb_offset, position] = enemy_view.get(entity);
+
+					// 血条比率
+					const auto ratio = current_health.health / max_health.health;
+					const auto hb_position = Transform::interpolated_position_of(const_registry, entity, position.position) + hb_offset.offset;
+
+					graphics::HealthBar::generate(
+						hb_position,
+						hb_size.size,
+						ratio,
+						std::span{vertices}.subspan(i * graphics::HealthBar::vertices_per_bar).first<graphics::HealthBar::vertices_per_bar>()
+					);
+				}
+			}
+		);
+
+		return vertex_count;
+	}
+}
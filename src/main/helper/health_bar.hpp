@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+#include <entt/fwd.hpp>
+
+namespace helper
+{
+	class HealthBar
+	{
+	public:
+		// 收集视图内需要绘制血条的敌人,生成顶点到health_bar::Buffer
+		// 返回有效的顶点数量(每个需要绘制的敌人恰好graphics::HealthBar::vertices_per_bar个)
+		[[nodiscard]] static auto build(entt::registry& registry) noexcept -> std::size_t;
+	};
+}
@@ -0,0 +1,49 @@
+#include <helper/name.hpp>
+
+#include <cassert>
+
+#include <entt/entt.hpp>
+
+namespace helper
+{
+	auto Name::intern(entt::registry& registry, const std::string_view name) noexcept -> components::combat::Name
+	{
+		using namespace components;
+
+		auto& [names, ids] = registry.ctx().get<combat::NameTable>();
+
+		if (const auto it = ids.find(name);
+			it != ids.end())
+		{
+			return {.id = it->second};
+		}
+
+		const auto id = static_cast<combat::Name::id_type>(names.size());
+		const auto& interned = names.emplace_back(name);
+		ids.emplace(interned, id);
+
+		return {.id = id};
+	}
+
+	auto Name::name_of(const entt::registry& registry, const components::combat::Name name) noexcept -> std::string_view
+	{
+		using namespace components;
+
+		const auto& [names, ids] = registry.ctx().get<const combat::NameTable>();
+		assert(name.id < names.size());
+
+		return names[name.id];
+	}
+
+	auto Name::name_of(const entt::registry& registry, const entt::entity entity) noexcept -> std::string_view
+	{
+		using namespace components;
+
+		if (const auto* name = registry.try_get<const combat::Name>(entity))
+		{
+			return name_of(registry, *name);
+		}
+
+		return {};
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string_view>
+
+#include <components/combat/unit.hpp>
+
+#include <entt/fwd.hpp>
+
+namespace helper
+{
+	class Name
+	{
+	public:
+		// 获取名称对应的索引(不存在则添加)
+		[[nodiscard]] static auto intern(entt::registry& registry, std::string_view name) noexcept -> components::combat::Name;
+
+		// 获取名称
+		[[nodiscard]] static auto name_of(const entt::registry& registry, components::combat::Name name) noexcept -> std::string_view;
+
+		// 获取实体名称(不包含EID),实体没有名称则返回空字符串
+		[[nodiscard]] static auto name_of(const entt::registry& registry, entt::entity entity) noexcept -> std::string_view;
+	};
+}
@@ -20,6 +20,11 @@ namespace helper
 			float distance_2;
 		};
 
+		// ===============================
+		// 按网格重建敌人索引(每个模拟步/载入快照后)
+
+		static auto rebuild(entt::registry& registry) noexcept -> void;
+
 		// ===============================
 		// 获取指定区域内的所有敌人实体
 
@@ -2,18 +2,22 @@
 
 #include <algorithm>
 #include <ranges>
-#include <print>
+#include <utility>
 
 #include <components/core/tags.hpp>
 #include <components/core/transform.hpp>
 #include <components/combat/unit.hpp>
 #include <components/game/player.hpp>
+#include <components/game/replay.hpp>
 #include <components/map/map.hpp>
 #include <components/map/navigation.hpp>
 
 #include <factory/tower.hpp>
 
 #include <helper/resource.hpp>
+#include <helper/replay.hpp>
+
+#include <logger/logger.hpp>
 
 #include <entt/entt.hpp>
 
@@ -37,21 +41,21 @@ namespace helper
 		// 检查是否选择了塔
 		if (player_selected_tower_type == combat::invalid_type)
 		{
-			std::println("未选择塔类型,建造失败");
+			logger::warning("未选择塔类型,建造失败");
 			return false;
 		}
 
 		// 检查位置是否合法
 		if (not tile_map.inside(grid_position.x, grid_position.y) or tile_map.at(grid_position.x, grid_position.y) != map::TileType::BUILDABLE_FLOOR)
 		{
-			std::println("位置({}:{})不在地图内或不可建造", grid_position.x, grid_position.y);
+			logger::warning("位置({}:{})不在地图内或不可建造", grid_position.x, grid_position.y);
 			return false;
 		}
 
 		// 检查资源是否足够
 		if (not Resource::require(registry, player_selected_tower_type))
 		{
-			std::println("资源不足");
+			logger::warning("资源不足");
 			return false;
 		}
 
@@ -77,7 +81,7 @@ namespace helper
 				{
 					// 该起点找不到一条到任意终点的路径
 					tile_map.set(grid_position.x, grid_position.y, map::TileType::BUILDABLE_FLOOR);
-					std::println("在({}:{})建造塔后将导致至少一个起点无法到达任意终点", grid_position.x, grid_position.y);
+					logger::warning("在({}:{})建造塔后将导致至少一个起点无法到达任意终点", grid_position.x, grid_position.y);
 					return false;
 				}
 
@@ -89,7 +93,7 @@ namespace helper
 		const auto tower_entity = factory::tower(registry, grid_position, player_selected_tower_type);
 		if (tower_entity == entt::null)
 		{
-			std::println("建造塔失败");
+			logger::warning("建造塔失败");
 			return false;
 		}
 
@@ -124,6 +128,8 @@ namespace helper
 			);
 		}
 
+		Replay::record(registry, replay::CommandType::BUILD_TOWER, std::to_underlying(player_selected_tower_type), grid_position);
+
 		return true;
 	}
 
@@ -142,14 +148,14 @@ namespace helper
 		// 检查位置是否合法
 		if (not tile_map.inside(grid_position.x, grid_position.y) or tile_map.at(grid_position.x, grid_position.y) != map::TileType::TOWER)
 		{
-			std::println("位置({}:{})不在地图内或未建造塔", grid_position.x, grid_position.y);
+			logger::warning("位置({}:{})不在地图内或未建造塔", grid_position.x, grid_position.y);
 			return false;
 		}
 
 		const auto tower_it = player_tower.find(grid_position);
 		if (tower_it == player_tower.end())
 		{
-			std::println("位置({}:{})的塔非你建造", grid_position.x, grid_position.y);
+			logger::warning("位置({}:{})的塔非你建造", grid_position.x, grid_position.y);
 			return false;
 		}
 
@@ -166,6 +172,8 @@ namespace helper
 		// 更新流场
 		flow_field.update(grid_position);
 
+		Replay::record(registry, replay::CommandType::DESTROY_TOWER, 0, grid_position);
+
 		return true;
 	}
 }
@@ -0,0 +1,213 @@
+#include <helper/replay.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#include <components/combat/unit.hpp>
+#include <components/game/game.hpp>
+#include <components/game/player.hpp>
+#include <components/game/resource.hpp>
+#include <components/map/map.hpp>
+
+#include <factory/enemy.hpp>
+
+#include <helper/player.hpp>
+#include <helper/resource.hpp>
+#include <helper/wave.hpp>
+
+#include <update/simulation.hpp>
+
+#include <utility/mapped_file.hpp>
+#include <utility/write_file.hpp>
+
+#include <logger/logger.hpp>
+
+#include <entt/entt.hpp>
+
+namespace helper
+{
+	auto Replay::start(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		registry.ctx().insert_or_assign(replay::Recording{});
+	}
+
+	auto Replay::stop(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		registry.ctx().erase<replay::Recording>();
+	}
+
+	auto Replay::record(entt::registry& registry, const components::replay::CommandType type, const std::uint32_t value, const sf::Vector2u point) noexcept -> void
+	{
+		using namespace components;
+
+		auto* recording = registry.ctx().find<replay::Recording>();
+		if (recording == nullptr)
+		{
+			return;
+		}
+
+		const auto [tick] = registry.ctx().get<const game::SimulationTick>();
+
+		recording->commands.emplace_back(tick, type, value, point.x, point.y);
+	}
+
+	auto Replay::apply(entt::registry& registry, const components::replay::Command& command) noexcept -> bool
+	{
+		using namespace components;
+
+		const auto point = sf::Vector2u{command.x, command.y};
+
+		switch (command.type)
+		{
+			case replay::CommandType::BUILD_TOWER:
+			{
+				const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+
+				auto& [player_selected_tower_type] = registry.ctx().get<player::Interaction>();
+				player_selected_tower_type = static_cast<combat::Type>(command.value);
+
+				return Player::try_build_tower(registry, tile_map.coordinate_grid_to_world(point));
+			}
+			case replay::CommandType::DESTROY_TOWER:
+			{
+				const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+
+				return Player::try_destroy_tower(registry, tile_map.coordinate_grid_to_world(point));
+			}
+			case replay::CommandType::SKIP_PREPARATION:
+			{
+				using sm = Wave::StateMachine;
+
+				sm::on(registry, sm::SkipPreparationRequested{});
+				return true;
+			}
+			case replay::CommandType::EARLY_START:
+			{
+				using sm = Wave::StateMachine;
+
+				sm::on(registry, sm::EarlyStartRequested{});
+				return true;
+			}
+			case replay::CommandType::START_WAVE:
+			{
+				Wave::start_from_wave(registry, {.index = command.value});
+				return true;
+			}
+			case replay::CommandType::SPAWN_WAVE:
+			{
+				return Wave::spawn_wave(registry, {.index = command.value}) != entt::null;
+			}
+			case replay::CommandType::SPAWN_ENEMY:
+			{
+				return factory::enemy(registry, command.x, static_cast<combat::Type>(command.value)) != entt::null;
+			}
+			case replay::CommandType::ACQUIRE_RESOURCE:
+			{
+				const auto bits = static_cast<std::uint64_t>(command.y) << 32 | command.x;
+				const auto amount = std::bit_cast<resource::size_type>(bits);
+
+				Resource::acquire(registry, resource::Resource{static_cast<resource::Type>(command.value), amount});
+				return true;
+			}
+		}
+
+		logger::warning("未知的回放指令: {}", std::to_underlying(command.type));
+		return false;
+	}
+
+	auto Replay::save(const entt::registry& registry, const std::filesystem::path& path) noexcept -> bool
+	{
+		using namespace components;
+
+		const auto* recording = registry.ctx().find<const replay::Recording>();
+		if (recording == nullptr)
+		{
+			return false;
+		}
+
+		const auto& [commands] = *recording;
+
+		const auto [seed] = registry.ctx().get<const game::Seed>();
+		const auto [tick] = registry.ctx().get<const game::SimulationTick>();
+
+		const Header header
+		{
+				.magic = magic,
+				.version = version,
+				.command_count = static_cast<std::uint32_t>(commands.size()),
+				.step = static_cast<std::uint32_t>(update::simulation_step.asMicroseconds()),
+				.seed = seed,
+				.tick_count = tick,
+		};
+
+		std::error_code error_code;
+		std::filesystem::create_directories(path.parent_path(), error_code);
+
+		return utility::write_file(
+			path,
+			[&](std::ostream& out) noexcept -> bool
+			{
+				out.write(reinterpret_cast<const char*>(&header), sizeof(Header)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+				out.write(reinterpret_cast<const char*>(commands.data()), static_cast<std::streamsize>(commands.size() * sizeof(replay::Command))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+				return not out.fail();
+			}
+		);
+	}
+
+	auto Replay::load(const std::filesystem::path& path) noexcept -> std::optional<Log>
+	{
+		using namespace components;
+
+		const auto file = utility::MappedFile::open(path);
+		if (not file.has_value())
+		{
+			return std::nullopt;
+		}
+
+		const auto bytes = file->bytes();
+		if (bytes.size() < sizeof(Header))
+		{
+			return std::nullopt;
+		}
+
+		Header header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		std::memcpy(&header, bytes.data(), sizeof(Header));
+
+		if (header.magic != magic or header.version != version)
+		{
+			logger::warning("回放版本不匹配");
+			return std::nullopt;
+		}
+
+		if ((bytes.size() - sizeof(Header)) / sizeof(replay::Command) < header.command_count)
+		{
+			logger::warning("回放数据无效");
+			return std::nullopt;
+		}
+
+		Log log
+		{
+				.seed = header.seed,
+				.tick_count = header.tick_count,
+				.step = header.step,
+				.commands = std::vector<replay::Command>(header.command_count),
+		};
+		std::memcpy(log.commands.data(), bytes.data() + sizeof(Header), header.command_count * sizeof(replay::Command));
+
+		// 录制时按tick追加,这里只是防御
+		if (not std::ranges::is_sorted(log.commands, std::ranges::less{}, &replay::Command::tick))
+		{
+			logger::warning("回放指令未按模拟步排序");
+			return std::nullopt;
+		}
+
+		return log;
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <components/game/replay.hpp>
+
+#include <utility/random.hpp>
+
+#include <entt/fwd.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace helper
+{
+	// 输入回放(录制玩家指令,无界面按最快速度重新执行)
+	// 模拟以固定步长执行且随机数只由种子派生,相同的种子与指令得到相同的结果
+	// [Header][Command...]
+	class Replay
+	{
+	public:
+		// "TDRP"
+		constexpr static std::uint32_t magic = 0x5052'4454;
+		// 文件布局(或指令含义)发生变化时递增
+		constexpr static std::uint32_t version = 1;
+
+		class Header
+		{
+		public:
+			std::uint32_t magic;
+			std::uint32_t version;
+
+			std::uint32_t command_count;
+			// 模拟步长(微秒),不一致时无法复现
+			std::uint32_t step;
+
+			utility::Random::seed_type seed;
+			// 录制结束时的模拟步数
+			std::uint64_t tick_count;
+		};
+
+		class Log
+		{
+		public:
+			utility::Random::seed_type seed;
+			std::uint64_t tick_count;
+			// 模拟步长(微秒)
+			std::uint32_t step;
+
+			// 按tick排序
+			std::vector<components::replay::Command> commands;
+		};
+
+		// 开始录制(丢弃已经录制的指令)
+		static auto start(entt::registry& registry) noexcept -> void;
+
+		// 停止录制(例如载入快照后,已经录制的指令无法从头复现)
+		static auto stop(entt::registry& registry) noexcept -> void;
+
+		// 记录指令(使用当前模拟步数),未录制时什么也不做
+		static auto record(entt::registry& registry, components::replay::CommandType type, std::uint32_t value = 0, sf::Vector2u point = {}) noexcept -> void;
+
+		// 执行指令,返回是否成功(与录制时的结果相同)
+		// 执行时同样会被录制,回放时不要开始录制
+		static auto apply(entt::registry& registry, const components::replay::Command& command) noexcept -> bool;
+
+		// 写入文件(种子/模拟步数取自registry),未录制时返回false
+		[[nodiscard]] static auto save(const entt::registry& registry, const std::filesystem::path& path) noexcept -> bool;
+
+		// 读取文件,文件无效(或版本不匹配)时返回nullopt
+		[[nodiscard]] static auto load(const std::filesystem::path& path) noexcept -> std::optional<Log>;
+	};
+}
@@ -0,0 +1,767 @@
+#include <helper/snapshot.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <config/wave.hpp>
+
+#include <components/core/tags.hpp>
+#include <components/core/transform.hpp>
+#include <components/core/renderable.hpp>
+#include <components/core/sprite_frame.hpp>
+#include <components/combat/unit.hpp>
+#include <components/combat/enemy.hpp>
+#include <components/combat/health_bar.hpp>
+#include <components/combat/limited_life.hpp>
+#include <components/combat/weapon.hpp>
+#include <components/game/game.hpp>
+#include <components/game/player.hpp>
+#include <components/game/wave.hpp>
+#include <components/map/map.hpp>
+#include <components/map/navigation.hpp>
+
+#include <initialize/event_connection.hpp>
+
+#include <helper/observer.hpp>
+#include <helper/tower.hpp>
+
+#include <utility/mapped_file.hpp>
+#include <utility/write_file.hpp>
+
+#include <logger/logger.hpp>
+
+#include <entt/entt.hpp>
+
+namespace
+{
+	using namespace components;
+
+	using helper::Snapshot;
+
+	static_assert(std::is_trivially_copyable_v<Snapshot::Header> and std::is_standard_layout_v<Snapshot::Header>);
+
+	// 存储中的实体数量(entt::snapshot写入)
+	using count_type = entt::entt_traits<entt::entity>::entity_type;
+
+	// 保存的组件存储(顺序即文件布局,修改时需要递增Snapshot::version)
+	// 以下组件不保存,载入时重新推导:
+	// weapon::Trigger(函数指针) / wave::Wave与wave::EndCondition(引用波次配置)
+	// 以下组件目前没有实体持有,不保存:
+	// sprite_frame::Variable / combat::OnDeath
+	using storages = entt::type_list<
+		// tags
+		tags::wave,
+		tags::tower,
+		tags::enemy,
+		tags::invisible,
+		tags::dead,
+		tags::cod_reached,
+		tags::cod_killed,
+		tags::targeting_ground,
+		tags::targeting_air,
+		tags::strategy_ground_first,
+		tags::strategy_air_first,
+		tags::strategy_distance_first,
+		tags::strategy_power_first,
+		tags::archetype_ground,
+		tags::archetype_aerial,
+		// transform
+		transform::Position,
+		transform::PreviousPosition,
+		transform::Scale,
+		transform::Rotation,
+		// renderable
+		renderable::Texture,
+		renderable::Area,
+		renderable::Origin,
+		renderable::Color,
+		// sprite_frame
+		sprite_frame::Timer,
+		sprite_frame::Condition,
+		sprite_frame::Frame,
+		sprite_frame::Uniform,
+		// combat
+		combat::Type,
+		combat::Name,
+		// enemy
+		enemy::Health,
+		enemy::Movement,
+		enemy::Power,
+		enemy::Direction,
+		// health_bar
+		health_bar::Health,
+		health_bar::Size,
+		health_bar::Offset,
+		// limited_life
+		limited_life::Time,
+		limited_life::Distance,
+		// weapon
+		weapon::Range,
+		weapon::FireRate,
+		weapon::Cooldown,
+		weapon::Target,
+		// wave
+		wave::WaveIndex,
+		wave::WavePreparationTimer,
+		wave::WaveEnemy,
+		wave::WaveState,
+		wave::SpawnIndex,
+		wave::WaveTimer
+	>;
+
+	// 实体存储 + 组件存储
+	constexpr auto storage_count = static_cast<std::uint32_t>(storages::size + 1);
+
+	[[nodiscard]] constexpr auto zigzag(const std::int64_t value) noexcept -> std::uint64_t
+	{
+		return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+	}
+
+	[[nodiscard]] constexpr auto unzigzag(const std::uint64_t value) noexcept -> std::int64_t
+	{
+		return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+	}
+
+	// 输出存档(entt::snapshot)
+	// entt按实体交错写入(数量,实体,组件,实体,组件...),这里将每个存储拆分为按列存储的块:
+	// [数量(varint)...][实体列字节数(varint)][实体列(索引差值+版本,varint)][组件列]
+	class Writer
+	{
+		std::vector<std::byte>& bytes_;
+
+		std::vector<std::byte> entities_;
+		std::vector<std::byte> components_;
+
+		// 上一个实体的索引(同一批创建的实体索引大多连续,差值只需要一个字节)
+		count_type last_index_;
+
+		static auto write_varint(std::vector<std::byte>& out, std::uint64_t value) noexcept -> void
+		{
+			while (value >= 0x80)
+			{
+				out.push_back(static_cast<std::byte>((value & 0x7f) | 0x80));
+				value >>= 7;
+			}
+			out.push_back(static_cast<std::byte>(value));
+		}
+
+		static auto write_bytes(std::vector<std::byte>& out, const void* data, const std::size_t size) noexcept -> void
+		{
+			const auto offset = out.size();
+			out.resize(offset + size);
+			std::memcpy(out.data() + offset, data, size);
+		}
+
+	public:
+		explicit Writer(std::vector<std::byte>& bytes) noexcept
+			: bytes_{bytes},
+			  last_index_{0} {}
+
+		// =========================
+		// 上下文
+
+		auto varint(const std::uint64_t value) noexcept -> void
+		{
+			write_varint(bytes_, value);
+		}
+
+		auto string(const std::string_view string) noexcept -> void
+		{
+			write_varint(bytes_, string.size());
+			write_bytes(bytes_, string.data(), string.size());
+		}
+
+		// =========================
+		// entt::snapshot
+
+		// 存储大小(以及实体存储的free_list)
+		auto operator()(const count_type count) noexcept -> void
+		{
+			write_varint(bytes_, count);
+		}
+
+		auto operator()(const entt::entity entity) noexcept -> void
+		{
+			const auto index = entt::to_entity(entity);
+
+			write_varint(entities_, zigzag(static_cast<std::int64_t>(index) - static_cast<std::int64_t>(last_index_)));
+			write_varint(entities_, entt::to_version(entity));
+
+			last_index_ = index;
+		}
+
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		auto operator()(const T& component) noexcept -> void
+		{
+			write_bytes(components_, &component, sizeof(T));
+		}
+
+		auto operator()(const wave::WaveEnemy& wave_enemy) noexcept -> void
+		{
+			write_varint(components_, wave_enemy.enemy.size());
+			for (const auto entity: wave_enemy.enemy)
+			{
+				write_varint(components_, entt::to_integral(entity));
+			}
+		}
+
+		// 结束当前存储
+		auto flush() noexcept -> void
+		{
+			write_varint(bytes_, entities_.size());
+			bytes_.insert(bytes_.end(), entities_.begin(), entities_.end());
+			bytes_.insert(bytes_.end(), components_.begin(), components_.end());
+
+			entities_.clear();
+			components_.clear();
+			last_index_ = 0;
+		}
+	};
+
+	// 输入存档(entt::snapshot_loader)
+	// 越界或数据无效时标记失败,之后的读取都返回空值
+	class Reader
+	{
+		std::span<const std::byte> bytes_;
+
+		// 上下文/存储块头的读取位置
+		std::size_t position_;
+
+		// 当前存储的实体列/组件列读取位置
+		bool opened_;
+		std::size_t entity_position_;
+		std::size_t entity_end_;
+		std::size_t component_position_;
+
+		count_type last_index_;
+
+		bool failed_;
+
+		[[nodiscard]] auto read_varint(std::size_t& position, const std::size_t end) noexcept -> std::uint64_t
+		{
+			std::uint64_t value = 0;
+			for (std::uint32_t shift = 0; shift < 64 and position < end; shift += 7)
+			{
+				const auto byte = std::to_integer<std::uint64_t>(bytes_[position]);
+				position += 1;
+
+				value |= (byte & 0x7f) << shift;
+				if ((byte & 0x80) == 0)
+				{
+					return value;
+				}
+			}
+
+			failed_ = true;
+			return 0;
+		}
+
+		auto read_bytes(std::size_t& position, const std::size_t end, void* data, const std::size_t size) noexcept -> void
+		{
+			if (size > end - position)
+			{
+				failed_ = true;
+				position = end;
+				std::memset(data, 0, size);
+				return;
+			}
+
+			std::memcpy(data, bytes_.data() + position, size);
+			position += size;
+		}
+
+		// 存储的数量之后才是实体列的字节数
+		auto open() noexcept -> void
+		{
+			if (opened_)
+			{
+				return;
+			}
+			opened_ = true;
+
+			const auto entity_size = read_varint(position_, bytes_.size());
+			if (entity_size > bytes_.size() - position_)
+			{
+				failed_ = true;
+				position_ = bytes_.size();
+			}
+
+			entity_position_ = position_;
+			entity_end_ = failed_ ? position_ : position_ + entity_size;
+			component_position_ = entity_end_;
+		}
+
+	public:
+		explicit Reader(const std::span<const std::byte> bytes) noexcept
+			: bytes_{bytes},
+			  position_{0},
+			  opened_{false},
+			  entity_position_{0},
+			  entity_end_{0},
+			  component_position_{0},
+			  last_index_{0},
+			  failed_{false} {}
+
+		[[nodiscard]] auto failed() const noexcept -> bool
+		{
+			return failed_;
+		}
+
+		// 所有数据都已读取
+		[[nodiscard]] auto done() const noexcept -> bool
+		{
+			return not failed_ and position_ == bytes_.size();
+		}
+
+		// =========================
+		// 上下文
+
+		[[nodiscard]] auto varint() noexcept -> std::uint64_t
+		{
+			return read_varint(position_, bytes_.size());
+		}
+
+		[[nodiscard]] auto string() noexcept -> std::string
+		{
+			const auto size = read_varint(position_, bytes_.size());
+			if (size > bytes_.size() - position_)
+			{
+				failed_ = true;
+				return {};
+			}
+
+			std::string string(size, '\0');
+			read_bytes(position_, bytes_.size(), string.data(), size);
+			return string;
+		}
+
+		// =========================
+		// entt::snapshot_loader
+
+		auto operator()(count_type& count) noexcept -> void
+		{
+			const auto value = read_varint(position_, bytes_.size());
+
+			// 每个实体至少占用一个字节,避免无效数据导致巨大的分配
+			if (value > bytes_.size() - position_)
+			{
+				failed_ = true;
+				count = 0;
+				return;
+			}
+
+			count = static_cast<count_type>(value);
+		}
+
+		auto operator()(entt::entity& entity) noexcept -> void
+		{
+			open();
+
+			const auto delta = unzigzag(read_varint(entity_position_, entity_end_));
+			const auto version = read_varint(entity_position_, entity_end_);
+			if (failed_)
+			{
+				entity = entt::null;
+				return;
+			}
+
+			const auto index = static_cast<count_type>(static_cast<std::int64_t>(last_index_) + delta);
+			last_index_ = index;
+
+			entity = entt::entt_traits<entt::entity>::construct(index, static_cast<entt::entt_traits<entt::entity>::version_type>(version));
+		}
+
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		auto operator()(T& component) noexcept -> void
+		{
+			open();
+
+			read_bytes(component_position_, bytes_.size(), &component, sizeof(T));
+		}
+
+		auto operator()(wave::WaveEnemy& wave_enemy) noexcept -> void
+		{
+			open();
+
+			const auto count = read_varint(component_position_, bytes_.size());
+			if (count > bytes_.size() - component_position_)
+			{
+				failed_ = true;
+				return;
+			}
+
+			wave_enemy.enemy.reserve(count);
+			for (std::uint64_t i = 0; i < count; ++i)
+			{
+				wave_enemy.enemy.push_back(static_cast<entt::entity>(read_varint(component_position_, bytes_.size())));
+			}
+		}
+
+		// 结束当前存储
+		auto next() noexcept -> void
+		{
+			open();
+
+			position_ = component_position_;
+			opened_ = false;
+			last_index_ = 0;
+		}
+	};
+
+	// 快照中的模拟上下文
+	class Context
+	{
+	public:
+		std::uint64_t tick;
+		sf::Time elapsed;
+		utility::Random::seed_type seed;
+		std::uint64_t spawn_count;
+
+		wave::index_type wave_current_index;
+		entt::entity wave_current_entity;
+
+		player::Statistics::size_type killed_enemy;
+		// 按资源类型排序(保证相同的状态得到相同的快照)
+		std::vector<std::pair<resource::Type, resource::size_type>> resources;
+
+		// 名称表(combat::Name引用其索引)
+		std::vector<std::string> names;
+	};
+
+	auto save_context(const entt::registry& registry, Writer& writer) noexcept -> void
+	{
+		const auto [elapsed] = registry.ctx().get<const game::ElapsedSimulationTime>();
+		const auto [tick] = registry.ctx().get<const game::SimulationTick>();
+		const auto [seed] = registry.ctx().get<const game::Seed>();
+		const auto [spawn_count] = registry.ctx().get<const game::SpawnCounter>();
+
+		const auto [wave_current_index] = registry.ctx().get<const wave::WaveCurrentIndex>();
+		const auto [wave_current_entity] = registry.ctx().get<const wave::WaveCurrentEntity>();
+
+		const auto [killed_enemy] = registry.ctx().get<const player::Statistics>();
+		const auto& [player_resource] = registry.ctx().get<const player::Resource>();
+
+		const auto& [names, ids] = registry.ctx().get<const combat::NameTable>();
+
+		writer.varint(tick);
+		writer.varint(zigzag(elapsed.asMicroseconds()));
+		writer.varint(seed);
+		writer.varint(spawn_count);
+
+		writer.varint(wave_current_index);
+		writer.varint(entt::to_integral(wave_current_entity));
+
+		writer.varint(killed_enemy);
+
+		std::vector<std::pair<resource::Type, resource::size_type>> resources{player_resource.begin(), player_resource.end()};
+		std::ranges::sort(resources);
+
+		writer.varint(resources.size());
+		for (const auto [type, amount]: resources)
+		{
+			writer.varint(std::to_underlying(type));
+			writer.varint(zigzag(amount));
+		}
+
+		writer.varint(names.size());
+		for (const auto& name: names)
+		{
+			writer.string(name);
+		}
+	}
+
+	[[nodiscard]] auto load_context(Reader& reader) noexcept -> Context
+	{
+		Context context{};
+
+		context.tick = reader.varint();
+		context.elapsed = sf::microseconds(unzigzag(reader.varint()));
+		context.seed = reader.varint();
+		context.spawn_count = reader.varint();
+
+		context.wave_current_index = static_cast<wave::index_type>(reader.varint());
+		context.wave_current_entity = static_cast<entt::entity>(reader.varint());
+
+		context.killed_enemy = static_cast<player::Statistics::size_type>(reader.varint());
+
+		const auto resource_count = reader.varint();
+		for (std::uint64_t i = 0; i < resource_count and not reader.failed(); ++i)
+		{
+			const auto type = static_cast<resource::Type>(reader.varint());
+			const auto amount = unzigzag(reader.varint());
+
+			context.resources.emplace_back(type, amount);
+		}
+
+		const auto name_count = reader.varint();
+		for (std::uint64_t i = 0; i < name_count and not reader.failed(); ++i)
+		{
+			context.names.emplace_back(reader.string());
+		}
+
+		return context;
+	}
+
+	template<typename... Ts>
+	auto save_storages(const entt::registry& registry, Writer& writer, entt::type_list<Ts...>) noexcept -> void
+	{
+		const entt::snapshot snapshot{registry};
+
+		snapshot.get<entt::entity>(writer);
+		writer.flush();
+
+		((snapshot.get<Ts>(writer), writer.flush()), ...);
+	}
+
+	template<typename... Ts>
+	auto load_storages(entt::registry& registry, Reader& reader, entt::type_list<Ts...>) noexcept -> void
+	{
+		entt::snapshot_loader loader{registry};
+
+		loader.get<entt::entity>(reader);
+		reader.next();
+
+		((loader.get<Ts>(reader), reader.next()), ...);
+	}
+
+	// 载入的实体中不保存的组件(此时新的存储还没有连接事件)
+	[[nodiscard]] auto derive_components(const entt::registry& registry, entt::registry& loaded) noexcept -> bool
+	{
+		const auto& [waves] = registry.ctx().get<const config::wave::Waves>();
+
+		// 波次配置
+		for (const auto [entity, wave_index]: loaded.view<const wave::WaveIndex>().each())
+		{
+			if (wave_index.index >= waves.size())
+			{
+				logger::warning("快照中的波次{}不存在", wave_index.index);
+				return false;
+			}
+
+			const auto& [spawns, end_condition, preparation_time] = waves[wave_index.index];
+
+			loaded.emplace<wave::Wave>(entity, spawns);
+			loaded.emplace<wave::EndCondition>(entity, end_condition);
+		}
+
+		// 开火方式(与factory::tower一致)
+		for (const auto entity: loaded.view<tags::tower>())
+		{
+			loaded.emplace<weapon::Trigger>(entity, &helper::Tower::fire);
+		}
+
+		return true;
+	}
+
+	// 替换实体后推导上下文中的缓存
+	auto derive_context(entt::registry& registry, const Context& context) noexcept -> void
+	{
+		// 模拟状态
+		{
+			auto& [elapsed] = registry.ctx().get<game::ElapsedSimulationTime>();
+			auto& [tick] = registry.ctx().get<game::SimulationTick>();
+			auto& [seed] = registry.ctx().get<game::Seed>();
+			auto& [spawn_count] = registry.ctx().get<game::SpawnCounter>();
+
+			elapsed = context.elapsed;
+			tick = context.tick;
+			seed = context.seed;
+			spawn_count = context.spawn_count;
+		}
+		// 波次
+		{
+			registry.ctx().insert_or_assign(wave::WaveCurrentIndex{.index = context.wave_current_index});
+			registry.ctx().insert_or_assign(wave::WaveCurrentEntity{.entity = context.wave_current_entity});
+		}
+		// 玩家
+		{
+			auto& [killed_enemy] = registry.ctx().get<player::Statistics>();
+			auto& [player_resource] = registry.ctx().get<player::Resource>();
+
+			killed_enemy = context.killed_enemy;
+			player_resource.clear();
+			player_resource.insert(context.resources.begin(), context.resources.end());
+		}
+		// 名称表
+		{
+			auto& [names, ids] = registry.ctx().get<combat::NameTable>();
+
+			ids.clear();
+			names.assign(context.names.begin(), context.names.end());
+			for (const auto [id, name]: names | std::views::enumerate)
+			{
+				ids.emplace(name, static_cast<combat::Name::id_type>(id));
+			}
+		}
+
+		// 地块(塔所在的网格)
+		{
+			auto& [tile_map] = registry.ctx().get<map_ex::TileMap>();
+			auto& [player_tower] = registry.ctx().get<player::Tower>();
+
+			for (const auto grid_position: player_tower | std::views::keys)
+			{
+				tile_map.set(grid_position.x, grid_position.y, map::TileType::BUILDABLE_FLOOR);
+			}
+			player_tower.clear();
+
+			for (const auto [entity, position]: registry.view<tags::tower, const transform::Position>().each())
+			{
+				const auto grid_position = tile_map.coordinate_world_to_grid(position.position);
+
+				tile_map.set(grid_position.x, grid_position.y, map::TileType::TOWER);
+				player_tower.emplace(grid_position, entity);
+			}
+		}
+		// 流场与缓存路径
+		{
+			const auto& [start_gates] = registry.ctx().get<const map_ex::StartGate>();
+			const auto& [end_gates] = registry.ctx().get<const map_ex::EndGate>();
+
+			auto& [flow_field] = registry.ctx().get<navigation::FlowField>();
+			auto& [cache_paths] = registry.ctx().get<navigation::Path>();
+
+			// 流场版本递增,调试绘制的顶点会重新生成
+			flow_field.build(end_gates);
+
+			cache_paths.clear();
+			for (const auto start: start_gates)
+			{
+				auto path = flow_field.path_of(start, std::numeric_limits<std::size_t>::max());
+				assert(path.has_value());
+
+				cache_paths.emplace_back(*std::move(path));
+			}
+		}
+		// 观察者
+		{
+			helper::Observer::rebuild(registry);
+		}
+		// 武器调度
+		// 所有武器都进入冷却队列,冷却已经结束的武器在下一个模拟步进入就绪列表
+		{
+			auto& [cooling, ready] = registry.ctx().get<weapon::Schedule>();
+
+			cooling = {};
+			ready.clear();
+			for (const auto [entity, cooldown]: registry.view<const weapon::Cooldown>().each())
+			{
+				cooling.emplace(cooldown.ready_time, entity);
+			}
+		}
+	}
+}
+
+namespace helper
+{
+	auto Snapshot::save(const entt::registry& registry, std::vector<std::byte>& bytes) noexcept -> void
+	{
+		using namespace components;
+
+		const auto [tick] = registry.ctx().get<const game::SimulationTick>();
+
+		const Header header
+		{
+				.magic = magic,
+				.version = version,
+				.storage_count = storage_count,
+				.reserved = 0,
+				.tick = tick,
+		};
+
+		bytes.resize(sizeof(Header));
+		std::memcpy(bytes.data(), &header, sizeof(Header));
+
+		Writer writer{bytes};
+
+		save_context(registry, writer);
+		save_storages(registry, writer, storages{});
+	}
+
+	auto Snapshot::save(const entt::registry& registry, const std::filesystem::path& path) noexcept -> bool
+	{
+		std::vector<std::byte> bytes;
+		save(registry, bytes);
+
+		std::error_code error_code;
+		std::filesystem::create_directories(path.parent_path(), error_code);
+
+		return utility::write_file(path, bytes);
+	}
+
+	auto Snapshot::load(entt::registry& registry, const std::span<const std::byte> bytes) noexcept -> bool
+	{
+		using namespace components;
+
+		if (bytes.size() < sizeof(Header))
+		{
+			return false;
+		}
+
+		Header header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		std::memcpy(&header, bytes.data(), sizeof(Header));
+
+		if (header.magic != magic or header.version != version or header.storage_count != storage_count)
+		{
+			logger::warning("快照版本不匹配");
+			return false;
+		}
+
+		Reader reader{bytes.subspan(sizeof(Header))};
+
+		const auto context = load_context(reader);
+
+		// 载入到新的注册表中,全部成功后再替换,失败时不影响当前状态
+		entt::registry loaded{};
+		load_storages(loaded, reader, storages{});
+
+		if (not reader.done())
+		{
+			logger::warning("快照数据无效");
+			return false;
+		}
+
+		if (context.wave_current_entity != entt::null and not loaded.valid(context.wave_current_entity))
+		{
+			logger::warning("快照中的当前波次实体无效");
+			return false;
+		}
+
+		if (not derive_components(registry, loaded))
+		{
+			return false;
+		}
+
+		// 替换实体与组件存储,上下文(静态数据/资源/系统状态)保留在原注册表中
+		registry.swap(loaded);
+		std::swap(registry.ctx(), loaded.ctx());
+
+		// 事件连接位于组件存储中,需要重新连接
+		initialize::event_connection(registry);
+
+		derive_context(registry, context);
+
+		logger::info("载入快照(模拟步数: {}, 实体数量: {})", context.tick, registry.storage<entt::entity>().free_list());
+		return true;
+	}
+
+	auto Snapshot::load(entt::registry& registry, const std::filesystem::path& path) noexcept -> bool
+	{
+		const auto file = utility::MappedFile::open(path);
+		if (not file.has_value())
+		{
+			return false;
+		}
+
+		return load(registry, file->bytes());
+	}
+}
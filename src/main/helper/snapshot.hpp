@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <entt/fwd.hpp>
+
+namespace helper
+{
+	// 注册表快照(存档/自动存档)
+	// 只保存无法推导的状态(实体/组件/模拟上下文),组件按存储逐列写入,实体标识使用变长整数编码
+	// 地块/流场/缓存路径/观察者索引/武器调度等缓存在载入时重新推导,不写入快照
+	// [Header][上下文][存储...]
+	class Snapshot
+	{
+	public:
+		// "TDSS"
+		constexpr static std::uint32_t magic = 0x5353'4454;
+		// 文件布局(或保存的组件)发生变化时递增
+		constexpr static std::uint32_t version = 1;
+
+		class Header
+		{
+		public:
+			std::uint32_t magic;
+			std::uint32_t version;
+
+			// 存储数量(包括实体存储)
+			std::uint32_t storage_count;
+			std::uint32_t reserved;
+
+			// 保存时的模拟步数
+			std::uint64_t tick;
+		};
+
+		// 序列化到bytes(覆盖已有内容,复用其容量),可以用于自动存档
+		static auto save(const entt::registry& registry, std::vector<std::byte>& bytes) noexcept -> void;
+
+		// 写入文件
+		[[nodiscard]] static auto save(const entt::registry& registry, const std::filesystem::path& path) noexcept -> bool;
+
+		// 替换当前所有实体(registry必须已经初始化,并且载入了相同的地图/波次/预制体数据)
+		// 数据无效(或版本不匹配)时返回false且不修改registry
+		[[nodiscard]] static auto load(entt::registry& registry, std::span<const std::byte> bytes) noexcept -> bool;
+
+		// 从文件载入
+		[[nodiscard]] static auto load(entt::registry& registry, const std::filesystem::path& path) noexcept -> bool;
+	};
+}
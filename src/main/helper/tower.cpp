@@ -1,6 +1,12 @@
 #include <helper/tower.hpp>
 
 #include <components/core/tags.hpp>
+#include <components/core/transform.hpp>
+#include <components/combat/weapon.hpp>
+#include <components/game/asset.hpp>
+
+#include <helper/audio.hpp>
+#include <helper/enemy.hpp>
 
 #include <entt/entt.hpp>
 
@@ -31,4 +37,35 @@ namespace helper
 
 		std::unreachable();
 	}
+
+	auto Tower::fire(entt::registry& registry, const entt::entity attacker, const entt::entity victim) noexcept -> void
+	{
+		using namespace components;
+
+		// 如果多个武器攻击同一目标,此时该目标可能已经死亡
+		// todo: AoE攻击?
+		if (registry.all_of<tags::dead>(victim))
+		{
+			// 移除目标
+			registry.remove<weapon::Target>(attacker);
+			return;
+		}
+
+		// 攻击效果
+		{
+			// const auto& [from] = registry.get<const entity::Position>(attacker);
+			// const auto& [to] = registry.get<const entity::Position>(victim);
+			// Bullet::laser(registry, from, to, sf::Color::Green);
+		}
+
+		// 攻击音效(只记录声源,由update::audio统一处理)
+		{
+			const auto [position] = registry.get<const transform::Position>(attacker);
+
+			Audio::emit(registry, asset::constants::laser, position);
+		}
+
+		// todo: 不应该在这里负责对敌人造成伤害
+		Enemy::hurt(registry, attacker, victim, 10.f);
+	}
 }
@@ -11,5 +11,8 @@ namespace helper
 	public:
 		// 获取塔的索敌类型
 		[[nodiscard]] static auto targeting_of(const entt::registry& registry, entt::entity tower) noexcept -> components::enemy::Archetype;
+
+		// 默认的武器开火(weapon::Trigger)
+		static auto fire(entt::registry& registry, entt::entity attacker, entt::entity victim) noexcept -> void;
 	};
 }
@@ -0,0 +1,24 @@
+#include <helper/transform.hpp>
+
+#include <components/core/transform.hpp>
+#include <components/game/game.hpp>
+
+#include <entt/entt.hpp>
+
+namespace helper
+{
+	auto Transform::interpolated_position_of(const entt::registry& registry, const entt::entity entity, const sf::Vector2f position) noexcept -> sf::Vector2f
+	{
+		using namespace components;
+
+		// 不移动的实体没有上一个位置
+		if (const auto* previous_position = registry.try_get<const transform::PreviousPosition>(entity))
+		{
+			const auto [alpha] = registry.ctx().get<const game::Interpolation>();
+
+			return previous_position->position + (position - previous_position->position) * alpha;
+		}
+
+		return position;
+	}
+}
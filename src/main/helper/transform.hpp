@@ -0,0 +1,15 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace helper
+{
+	class Transform
+	{
+	public:
+		// 获取实体的渲染位置(在上一个模拟步与当前模拟步之间插值)
+		[[nodiscard]] static auto interpolated_position_of(const entt::registry& registry, entt::entity entity, sf::Vector2f position) noexcept -> sf::Vector2f;
+	};
+}
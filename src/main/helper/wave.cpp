@@ -2,12 +2,15 @@
 
 #include <algorithm>
 #include <ranges>
-#include <print>
 
 #include <components/core/tags.hpp>
+#include <components/game/replay.hpp>
+
+#include <helper/replay.hpp>
 
 #include <utility/functional.hpp>
-#include <utility/time.hpp>
+
+#include <logger/logger.hpp>
 
 #include <meta/enumeration.hpp>
 
@@ -22,9 +25,8 @@ namespace helper
 
 		const auto [index] = registry.get<const wave::WaveIndex>(state.wave);
 
-		std::println(
-			"[{:%Y-%m-%d %H:%M:%S}] 波次{}状态切换: {} -> {}(EID:{})",
-			utility::zoned_now(),
+		logger::info(
+			"波次{}状态切换: {} -> {}(EID:{})",
 			index,
 			meta::name_of(state.old_state),
 			meta::name_of(state.new_state),
@@ -34,10 +36,7 @@ namespace helper
 
 	auto Wave::StateMachine::on(entt::registry& registry, const AllCompleted& event) noexcept -> void
 	{
-		std::println(
-			"[{:%Y-%m-%d %H:%M:%S}] ALL WAVES CLEARED!",
-			utility::zoned_now()
-		);
+		logger::info("ALL WAVES CLEARED!");
 	}
 
 	auto Wave::StateMachine::on(entt::registry& registry, const PreparationEnded& event) noexcept -> void
@@ -146,6 +145,8 @@ namespace helper
 
 		assert(registry.valid(wave_current_entity));
 
+		Replay::record(registry, replay::CommandType::SKIP_PREPARATION);
+
 		// todo: 需不需要检查当前是否处于准备阶段?理论上不检查也无所谓(但是可以增强鲁棒性)
 		{
 			const auto state = registry.get<const wave::WaveState>(wave_current_entity);
@@ -164,11 +165,14 @@ namespace helper
 		// 不能指定wave实体,或者说只有当前波次(实体)才支持该操作
 		const auto [wave_current_entity] = registry.ctx().get<const wave::WaveCurrentEntity>();
 
+		// 即使被拒绝也记录(回放时同样被拒绝)
+		Replay::record(registry, replay::CommandType::EARLY_START);
+
 		// 如果是计时波次则允许提前刷新,否则必须满足条件
 		if (const auto& [end_condition] = registry.get<const wave::EndCondition>(wave_current_entity);
 			not std::holds_alternative<wave::EndCondition::Duration>(end_condition))
 		{
-			std::println("非计时波次,无法提前刷新");
+			logger::warning("非计时波次,无法提前刷新");
 
 			return;
 		}
@@ -278,7 +282,7 @@ namespace helper
 		if (const auto [wave_total_count] = registry.ctx().get<const wave::WaveTotalCount>();
 			wave_index.index >= wave_total_count)
 		{
-			std::println("波次 {} 不存在,无法生成!", wave_index.index);
+			logger::warning("波次 {} 不存在,无法生成!", wave_index.index);
 			return entt::null;
 		}
 
@@ -2,6 +2,10 @@
 
 #include <components/game/asset.hpp>
 
+#include <graphics/atlas.hpp>
+
+#include <loaders/path.hpp>
+
 #include <entt/entt.hpp>
 
 namespace initialize
@@ -17,6 +21,24 @@ namespace initialize
 		auto& [sounds] = registry.ctx().emplace<asset::Sounds>();
 
 		// 预加载所有需要的资源
+		// 字体很小并且按需载入字形,直接同步载入
+		// 纹理/音效在线程池中解码,之后由update::asset在主线程上传
+		auto& [preloader] = registry.ctx().emplace<asset::Loading>();
+
+		// 资源热重载(监视media与config目录)
+		auto& [reloader] = registry.ctx().emplace<asset::HotReload>(loaders::Reloader{{loaders::Path::texture(), loaders::Path::config()}});
+
+		const auto texture = [&](const entt::id_type id, const std::filesystem::path& path) noexcept -> void
+		{
+			reloader.texture(id, path);
+			preloader.texture(id, path);
+		};
+
+		const auto sound = [&](const entt::id_type id, const std::filesystem::path& path) noexcept -> void
+		{
+			reloader.sound(id, path);
+			preloader.sound(id, path);
+		};
 
 		// 字体
 		{
@@ -33,8 +55,20 @@ namespace initialize
 		{
 			// 地图纹理
 			{
-				auto [it, result] = textures.load(asset::constants::map, loaders::TextureType::MAP, "map1");
-				assert(it->second);
+				texture(asset::constants::map, loaders::Texture::path_of(loaders::TextureType::MAP, "map1"));
+			}
+
+			// 纹理图集(由td_atlas生成,不存在时直接使用各个纹理)
+			const graphics::Atlas* atlas = nullptr;
+			if (auto data = graphics::Atlas::read(loaders::Path::texture_atlas() / graphics::Atlas::filename);
+				data.has_value())
+			{
+				atlas = std::addressof(registry.ctx().emplace<graphics::Atlas>(*std::move(data)));
+
+				for (std::size_t i = 0; i < atlas->pages().size(); ++i)
+				{
+					preloader.texture(atlas->pages()[i].id, loaders::Path::texture_atlas(graphics::Atlas::page_name(i)));
+				}
 			}
 
 			// 敌人纹理
@@ -52,8 +86,13 @@ namespace initialize
 					{
 						const entt::basic_hashed_string hash_name{name.data(), name.size()};
 
-						auto [it, result] = textures.load(hash_name, loaders::TextureType::ENEMY, name);
-						assert(it->second);
+						// 已经位于图集中
+						if (atlas != nullptr and atlas->find(hash_name) != nullptr)
+						{
+							return;
+						}
+
+						texture(hash_name, loaders::Texture::path_of(loaders::TextureType::ENEMY, name));
 					}
 				);
 			}
@@ -74,11 +113,12 @@ namespace initialize
 					{
 						const entt::basic_hashed_string hash_name{name.data(), name.size()};
 
-						auto [it, result] = sounds.load(hash_name, name);
-						assert(it->second);
+						sound(hash_name, loaders::Path::sound(name));
 					}
 				);
 			}
 		}
+
+		preloader.start();
 	}
 }
@@ -0,0 +1,15 @@
+#include <initialize/audio.hpp>
+
+#include <components/core/audio.hpp>
+
+#include <entt/entt.hpp>
+
+namespace initialize
+{
+	auto audio(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		registry.ctx().emplace<audio::Emissions>();
+	}
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+namespace initialize
+{
+	auto audio(entt::registry& registry) noexcept -> void;
+}
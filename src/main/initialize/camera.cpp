@@ -0,0 +1,22 @@
+#include <initialize/camera.hpp>
+
+#include <components/core/camera.hpp>
+#include <components/map/map.hpp>
+
+#include <entt/entt.hpp>
+
+namespace initialize
+{
+	auto camera(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+
+		// 初始看向地图中心
+		const auto map_bounds = tile_map.map_bounds<float>();
+
+		registry.ctx().emplace<camera::Camera>(map_bounds.getCenter(), 1.f, map_bounds.size);
+		registry.ctx().emplace<camera::Visible>();
+	}
+}
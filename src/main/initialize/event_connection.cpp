@@ -1,13 +1,15 @@
 #include <initialize/event_connection.hpp>
 
-#include <print>
+#include <utility>
 
 #include <components/core/tags.hpp>
 #include <components/core/transform.hpp>
 #include <components/combat/unit.hpp>
 #include <components/game/wave.hpp>
 
-#include <utility/time.hpp>
+#include <helper/name.hpp>
+
+#include <logger/logger.hpp>
 
 #include <entt/entt.hpp>
 
@@ -23,9 +25,8 @@ namespace
 				const auto [wave_index] = reg.get<const wave::WaveIndex>(entity);
 				const auto& [spawns] = reg.get<const wave::Wave>(entity);
 
-				std::println(
-					"[{:%Y-%m-%d %H:%M:%S}] 生成波次{},共{}个敌人(EID:{})",
-					utility::zoned_now(),
+				logger::info(
+					"生成波次{},共{}个敌人(EID:{})",
 					wave_index,
 					spawns.size(),
 					entt::to_integral(entity)
@@ -37,9 +38,8 @@ namespace
 			{
 				std::ignore = reg;
 
-				std::println(
-					"[{:%Y-%m-%d %H:%M:%S}] 结束波次(EID:{})",
-					utility::zoned_now(),
+				logger::info(
+					"结束波次(EID:{})",
 					entt::to_integral(entity)
 				);
 			}>();
@@ -54,11 +54,10 @@ namespace
 			{
 				const auto type = reg.get<const combat::Type>(entity);
 				const auto [position] = reg.get<const transform::Position>(entity);
-				const auto& [name] = reg.get<const combat::Name>(entity);
+				const auto name = helper::Name::name_of(reg, entity);
 
-				std::println(
-					"[{:%Y-%m-%d %H:%M:%S}] 在({:.0f}:{:.0f})建造[0x{:08x}]型塔[{}](EID:{})",
-					utility::zoned_now(),
+				logger::info(
+					"在({:.0f}:{:.0f})建造[0x{:08x}]型塔[{}](EID:{})",
 					position.x,
 					position.y,
 					std::to_underlying(type),
@@ -72,9 +71,8 @@ namespace
 			{
 				std::ignore = reg;
 
-				std::println(
-					"[{:%Y-%m-%d %H:%M:%S}] 销毁塔(EID:{})",
-					utility::zoned_now(),
+				logger::info(
+					"销毁塔(EID:{})",
 					std::to_underlying(entity)
 				);
 			}>();
@@ -89,11 +87,10 @@ namespace
 			{
 				const auto type = reg.get<const combat::Type>(entity);
 				const auto [position] = reg.get<const transform::Position>(entity);
-				const auto& [name] = reg.get<const combat::Name>(entity);
+				const auto name = helper::Name::name_of(reg, entity);
 
-				std::println(
-					"[{:%Y-%m-%d %H:%M:%S}] 在({:.0f}:{:.0f})生成[0x{:08x}]型敌人[{}](EID:{})",
-					utility::zoned_now(),
+				logger::debug(
+					"在({:.0f}:{:.0f})生成[0x{:08x}]型敌人[{}](EID:{})",
 					position.x,
 					position.y,
 					std::to_underlying(type),
@@ -107,9 +104,8 @@ namespace
 			{
 				std::ignore = reg;
 
-				std::println(
-					"[{:%Y-%m-%d %H:%M:%S}] 销毁敌人(EID:{})",
-					utility::zoned_now(),
+				logger::debug(
+					"销毁敌人(EID:{})",
 					std::to_underlying(entity)
 				);
 			}>();
@@ -1,7 +1,11 @@
 #include <initialize/game.hpp>
 
+#include <random>
+
 #include <components/game/game.hpp>
 
+#include <logger/logger.hpp>
+
 #include <entt/entt.hpp>
 
 namespace initialize
@@ -13,5 +17,15 @@ namespace initialize
 		registry.ctx().emplace<game::FrameDelta>(sf::seconds(1));
 		registry.ctx().emplace<game::ElapsedTime>(sf::Time::Zero);
 		registry.ctx().emplace<game::ElapsedSimulationTime>(sf::Time::Zero);
+		registry.ctx().emplace<game::SimulationTick>(std::uint64_t{0});
+		registry.ctx().emplace<game::Interpolation>(1.f);
+		registry.ctx().emplace<game::Commands>();
+
+		// 默认每局随机(回放/无界面模拟会覆盖该值)
+		const auto seed = (static_cast<utility::Random::seed_type>(std::random_device{}()) << 32) | std::random_device{}();
+		registry.ctx().emplace<game::Seed>(seed);
+		registry.ctx().emplace<game::SpawnCounter>(std::uint64_t{0});
+
+		logger::info("随机数种子: 0x{:016x}", seed);
 	}
 }
@@ -0,0 +1,16 @@
+#include <initialize/health_bar.hpp>
+
+#include <components/combat/health_bar.hpp>
+
+#include <entt/entt.hpp>
+
+namespace initialize
+{
+	auto health_bar(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		registry.ctx().emplace<health_bar::Options>(false);
+		registry.ctx().emplace<health_bar::Buffer>();
+	}
+}
@@ -6,11 +6,20 @@
 
 #include <components/map/map.hpp>
 
+#include <map/map_file.hpp>
+
+#include <loaders/path.hpp>
+
+#include <logger/logger.hpp>
+
 #include <entt/entt.hpp>
 
 namespace
 {
-	[[nodiscard]] auto load_map_data() noexcept -> config::map_ex::Map
+	constexpr std::string_view default_map_name{"map1"};
+
+	// 地图文件不存在时使用的默认地图
+	[[nodiscard]] auto default_map_config() noexcept -> config::map_ex::Map
 	{
 		using namespace config::map_ex;
 
@@ -147,13 +156,9 @@ namespace
 	}
 }
 
-namespace initialize
-{
-	auto map_data(entt::registry& registry) noexcept -> void
+	[[nodiscard]] auto default_map_data() noexcept -> map::MapFile::Data
 	{
-		using namespace components;
-
-		auto config = load_map_data();
+		auto config = default_map_config();
 
 		map::TileMap tile_map{config.tile_size.width, config.tile_size.height, config.tile_count.horizontal, config.tile_count.vertical};
 		{
@@ -201,8 +206,55 @@ namespace initialize
 			);
 		}
 
+		return
+		{
+				.tile_map = std::move(tile_map),
+				.start_gates = std::move(config.start_gate.points),
+				.end_gates = std::move(config.end_gate.points),
+		};
+	}
+
+	[[nodiscard]] auto load_map_data() noexcept -> map::MapFile::Data
+	{
+		const auto path = loaders::Path::map(default_map_name);
+
+		// 直接映射地图文件并解码
+		if (auto data = map::MapFile::read(path);
+			data.has_value())
+		{
+			return *std::move(data);
+		}
+
+		logger::warning("无法载入地图: {},使用默认地图", path.string());
+
+		// 写出默认地图,之后直接载入文件
+		auto data = default_map_data();
+
+		std::error_code error_code;
+		std::filesystem::create_directories(path.parent_path(), error_code);
+		if (map::MapFile::write(path, data.tile_map, data.start_gates, data.end_gates))
+		{
+			logger::info("写入默认地图: {}", path.string());
+		}
+		else
+		{
+			logger::error("无法写入地图: {}", path.string());
+		}
+
+		return data;
+	}
+}
+
+namespace initialize
+{
+	auto map_data(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		auto [tile_map, start_gates, end_gates] = load_map_data();
+
 		registry.ctx().emplace<map_ex::TileMap>(std::move(tile_map));
-		registry.ctx().emplace<map_ex::StartGate>(std::move(config.start_gate));
-		registry.ctx().emplace<map_ex::EndGate>(std::move(config.end_gate));
+		registry.ctx().emplace<map_ex::StartGate>(std::move(start_gates));
+		registry.ctx().emplace<map_ex::EndGate>(std::move(end_gates));
 	}
 }
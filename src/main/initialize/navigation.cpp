@@ -34,7 +34,11 @@ namespace initialize
 			}
 		}
 
+		// 版本不一致,第一次绘制时生成顶点
+		const auto overlay_generation = flow_field.generation() - 1;
+
 		registry.ctx().emplace<navigation::FlowField>(std::move(flow_field));
 		registry.ctx().emplace<navigation::Path>(std::move(cache_paths));
+		registry.ctx().emplace<navigation::Overlay>(overlay_generation);
 	}
 }
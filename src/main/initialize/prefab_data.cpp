@@ -0,0 +1,100 @@
+#include <initialize/prefab_data.hpp>
+
+#include <config/prefab.hpp>
+
+#include <helper/tower.hpp>
+
+#include <entt/entt.hpp>
+
+namespace
+{
+	[[nodiscard]] auto load_enemy_prefab() noexcept -> config::prefab::Enemy
+	{
+		using namespace components;
+
+		// 图集纹理大小为16*16
+		constexpr auto frame_size = sf::Vector2i{16, 16};
+
+		constexpr std::string_view enemy_name{"deep-dive-AntleredRascal"};
+		constexpr entt::basic_hashed_string enemy_hash_name{enemy_name.data(), enemy_name.size()};
+
+		return
+		{
+				// 放大一些
+				.scale = {.scale = {2.f, 2.f}},
+				.rotation = {.rotation = sf::degrees(0)},
+				.texture = {.id = enemy_hash_name},
+				.area = {.area = sf::IntRect{{0, 0}, frame_size}},
+				.origin = {.origin = sf::Vector2f{frame_size / 2}},
+				.color = {.color = sf::Color::White},
+				.timer = {.frame_duration = sf::seconds(.25f), .elapsed_time = sf::Time::Zero},
+				.condition = {.looping = true, .playing = true},
+				.frame = {.total_count = 4, .current_index = 0},
+				.uniform = {.frame_position = {0, 0}, .frame_size = frame_size},
+				.name = "AntleredRascal",
+				.archetype = enemy::Archetype::GROUND,
+				.health = {.health = 100},
+				.movement = {.speed = 30.f},
+				.movement_variance = 20.f,
+				.power = {.power = 1},
+				.power_variance = 100,
+				.health_bar_size = {.size = {static_cast<float>(frame_size.x), static_cast<float>(frame_size.y / 4)}}, // NOLINT(bugprone-integer-division)
+				.health_bar_offset = {.offset = {static_cast<float>(-frame_size.x / 2), -static_cast<float>(frame_size.y / 2) - 5.f}}, // NOLINT(bugprone-integer-division)
+		};
+	}
+
+	[[nodiscard]] auto load_tower_prefab() noexcept -> config::prefab::Tower
+	{
+		using namespace components;
+
+		// 图集纹理大小为16*16
+		constexpr auto frame_size = sf::Vector2i{16, 16};
+
+		// todo: 还没有为塔准备纹理,这里暂时使用敌人的纹理
+		constexpr std::string_view tower_name{"deep-dive-WarpSkull"};
+		constexpr entt::basic_hashed_string tower_hash_name{tower_name.data(), tower_name.size()};
+
+		return
+		{
+				// 放大一些
+				.scale = {.scale = {2.5f, 2.5f}},
+				.rotation = {.rotation = sf::degrees(0)},
+				.texture = {.id = tower_hash_name},
+				.area = {.area = sf::IntRect{{0, 0}, frame_size}},
+				.origin = {.origin = sf::Vector2f{frame_size / 2}},
+				.color = {.color = sf::Color::White},
+				.timer = {.frame_duration = sf::seconds(.5f), .elapsed_time = sf::Time::Zero},
+				.condition = {.looping = true, .playing = true},
+				.frame = {.total_count = 4, .current_index = 0},
+				.uniform = {.frame_position = {0, 0}, .frame_size = frame_size},
+				.name = "WarpSkull",
+				.range = {.range = 50.f},
+				.fire_rate = {.fire_rate = 1.5f},
+				.trigger = {.on_fire = &helper::Tower::fire},
+				// 攻击地面
+				.targeting = enemy::Archetype::GROUND,
+		};
+	}
+
+	[[nodiscard]] auto load_prefab_data() noexcept -> config::prefab::Prefabs
+	{
+		return
+		{
+				// 敌人/塔定义
+				.catalogue = loaders::Catalogue::open("catalogue"),
+				.default_enemy = load_enemy_prefab(),
+				.default_tower = load_tower_prefab(),
+		};
+	}
+}
+
+namespace initialize
+{
+	auto prefab_data(entt::registry& registry) noexcept -> void
+	{
+		// 所有预制体数据
+		registry.ctx().emplace<config::prefab::Prefabs>(load_prefab_data());
+		// 名称表
+		registry.ctx().emplace<components::combat::NameTable>();
+	}
+}
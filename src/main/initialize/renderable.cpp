@@ -0,0 +1,15 @@
+#include <initialize/renderable.hpp>
+
+#include <components/core/renderable.hpp>
+
+#include <entt/entt.hpp>
+
+namespace initialize
+{
+	auto renderable(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		registry.ctx().emplace<renderable::Batch>();
+	}
+}
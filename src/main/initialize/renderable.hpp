@@ -0,0 +1,8 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+namespace initialize
+{
+	auto renderable(entt::registry& registry) noexcept -> void;
+}
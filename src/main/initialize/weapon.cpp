@@ -0,0 +1,15 @@
+#include <initialize/weapon.hpp>
+
+#include <components/combat/weapon.hpp>
+
+#include <entt/entt.hpp>
+
+namespace initialize
+{
+	auto weapon(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		registry.ctx().emplace<weapon::Schedule>();
+	}
+}
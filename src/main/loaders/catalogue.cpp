@@ -0,0 +1,447 @@
+#include <loaders/catalogue.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <components/combat/enemy.hpp>
+
+#include <loaders/path.hpp>
+
+#include <utility/write_file.hpp>
+
+#include <logger/logger.hpp>
+
+#include <entt/core/hashed_string.hpp>
+
+#include <nlohmann/json.hpp>
+
+namespace
+{
+	using namespace loaders;
+
+	static_assert(std::is_trivially_copyable_v<Catalogue::Header> and std::is_standard_layout_v<Catalogue::Header>);
+	static_assert(std::is_trivially_copyable_v<Catalogue::EnemyRecord> and std::is_standard_layout_v<Catalogue::EnemyRecord>);
+	static_assert(std::is_trivially_copyable_v<Catalogue::TowerRecord> and std::is_standard_layout_v<Catalogue::TowerRecord>);
+
+	// 所有区块按8字节对齐
+	constexpr std::uint64_t block_alignment = 8;
+
+	[[nodiscard]] constexpr auto align(const std::uint64_t offset) noexcept -> std::uint64_t
+	{
+		return (offset + block_alignment - 1) / block_alignment * block_alignment;
+	}
+
+	class StringTable
+	{
+	public:
+		std::string strings;
+
+		[[nodiscard]] auto add(const std::string_view string) noexcept -> Catalogue::String
+		{
+			const auto offset = static_cast<std::uint32_t>(strings.size());
+			strings.append(string);
+
+			return {.offset = offset, .size = static_cast<std::uint32_t>(string.size())};
+		}
+	};
+
+	[[nodiscard]] auto archetype_of(const std::string_view name) noexcept -> std::uint32_t
+	{
+		using components::enemy::Archetype;
+
+		if (name == "AERIAL")
+		{
+			return std::to_underlying(Archetype::AERIAL);
+		}
+
+		if (name == "DUAL")
+		{
+			return std::to_underlying(Archetype::DUAL);
+		}
+
+		return std::to_underlying(Archetype::GROUND);
+	}
+
+	// 读取字段,字段不存在时返回默认值,类型不匹配(或超出范围)时警告并返回默认值
+	// json.value在类型不匹配时会抛出异常
+	template<typename T>
+	[[nodiscard]] auto value_of(const nlohmann::json& json, const std::string_view key, T fallback) noexcept -> T
+	{
+		const auto it = json.find(key);
+		if (it == json.end())
+		{
+			return fallback;
+		}
+
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			if (it->is_boolean())
+			{
+				return it->template get<bool>();
+			}
+		}
+		else if constexpr (std::is_integral_v<T>)
+		{
+			if (it->is_number_unsigned())
+			{
+				if (const auto value = it->template get<std::uint64_t>();
+					std::in_range<T>(value))
+				{
+					return static_cast<T>(value);
+				}
+			}
+			else if (it->is_number_integer())
+			{
+				if (const auto value = it->template get<std::int64_t>();
+					std::in_range<T>(value))
+				{
+					return static_cast<T>(value);
+				}
+			}
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			if (it->is_number())
+			{
+				return it->template get<T>();
+			}
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			if (it->is_string())
+			{
+				return it->template get_ref<const std::string&>();
+			}
+		}
+		else
+		{
+			static_assert(std::is_same_v<T, nlohmann::json>);
+
+			if (it->is_object())
+			{
+				return *it;
+			}
+		}
+
+		logger::warning("目录字段{}类型错误,使用默认值", key);
+		return fallback;
+	}
+
+	[[nodiscard]] constexpr auto valid_sprite(const Catalogue::Sprite& sprite) noexcept -> bool
+	{
+		return sprite.frame_width > 0 and sprite.frame_height > 0 and sprite.frame_count > 0;
+	}
+
+	[[nodiscard]] auto sprite_of(const nlohmann::json& json, StringTable& strings) noexcept -> Catalogue::Sprite
+	{
+		const auto texture = value_of(json, "texture", std::string{});
+
+		const auto frame = value_of(json, "frame", nlohmann::json::object());
+
+		Catalogue::Sprite sprite
+		{
+				.texture = strings.add(texture),
+				.texture_id = entt::hashed_string::value(texture.data(), texture.size()),
+				.scale = value_of(json, "scale", 1.f),
+				.frame_width = value_of(frame, "width", std::int32_t{16}),
+				.frame_height = value_of(frame, "height", std::int32_t{16}),
+				.frame_count = value_of(frame, "count", std::uint32_t{1}),
+				.frame_duration = value_of(frame, "duration", .25f),
+				.looping = value_of(frame, "looping", true) ? 1u : 0u,
+		};
+
+		// 没有帧(或帧大小无效)时无法计算纹理矩形,至少保留一帧
+		if (not valid_sprite(sprite))
+		{
+			logger::warning("纹理{}的帧无效({}x{}, {}帧),使用默认值", texture, sprite.frame_width, sprite.frame_height, sprite.frame_count);
+
+			sprite.frame_width = std::ranges::max(sprite.frame_width, std::int32_t{1});
+			sprite.frame_height = std::ranges::max(sprite.frame_height, std::int32_t{1});
+			sprite.frame_count = std::ranges::max(sprite.frame_count, std::uint32_t{1});
+		}
+
+		return sprite;
+	}
+
+	[[nodiscard]] auto enemy_of(const nlohmann::json& json, StringTable& strings) noexcept -> Catalogue::EnemyRecord
+	{
+		return
+		{
+				.type = value_of(json, "type", Catalogue::type_type{0}),
+				.name = strings.add(value_of(json, "name", std::string{})),
+				.sprite = sprite_of(json, strings),
+				.archetype = archetype_of(value_of(json, "archetype", std::string{"GROUND"})),
+				.health = value_of(json, "health", 100.f),
+				.speed = value_of(json, "speed", 30.f),
+				.speed_variance = value_of(json, "speed_variance", 0.f),
+				.power = value_of(json, "power", std::uint32_t{1}),
+				.power_variance = value_of(json, "power_variance", std::uint32_t{0}),
+		};
+	}
+
+	[[nodiscard]] auto tower_of(const nlohmann::json& json, StringTable& strings) noexcept -> Catalogue::TowerRecord
+	{
+		return
+		{
+				.type = value_of(json, "type", Catalogue::type_type{0}),
+				.name = strings.add(value_of(json, "name", std::string{})),
+				.sprite = sprite_of(json, strings),
+				.range = value_of(json, "range", 50.f),
+				.fire_rate = value_of(json, "fire_rate", 1.f),
+				.targeting = archetype_of(value_of(json, "targeting", std::string{"GROUND"})),
+		};
+	}
+
+	// 按类型排序并移除重复的类型(保留先定义的)
+	template<typename Record>
+	auto sort_records(std::vector<Record>& records, const std::string_view category) noexcept -> void
+	{
+		std::ranges::stable_sort(records, std::ranges::less{}, &Record::type);
+
+		const auto [first, last] = std::ranges::unique(records, std::ranges::equal_to{}, &Record::type);
+		if (first != last)
+		{
+			logger::warning("目录中存在{}个重复的{}类型,只保留第一个定义", std::ranges::distance(first, last), category);
+		}
+		records.erase(first, last);
+	}
+
+	template<typename Record>
+	[[nodiscard]] auto find_record(const std::span<const Record> records, const components::combat::Type type) noexcept -> const Record*
+	{
+		const auto value = std::to_underlying(type);
+
+		if (const auto it = std::ranges::lower_bound(records, value, std::ranges::less{}, &Record::type);
+			it != records.end() and it->type == value)
+		{
+			return std::to_address(it);
+		}
+
+		return nullptr;
+	}
+
+	template<typename Record>
+	[[nodiscard]] auto span_of(const std::span<const std::byte> bytes, const std::uint64_t offset, const std::uint32_t count) noexcept -> std::optional<std::span<const Record>>
+	{
+		if (offset % alignof(Record) != 0 or offset > bytes.size() or (bytes.size() - offset) / sizeof(Record) < count)
+		{
+			return std::nullopt;
+		}
+
+		// 文件由compile生成,记录布局与内存布局一致
+		return std::span{reinterpret_cast<const Record*>(bytes.data() + offset), count}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+	}
+}
+
+namespace loaders
+{
+	Catalogue::Catalogue(utility::MappedFile file, const std::span<const EnemyRecord> enemies, const std::span<const TowerRecord> towers, const std::string_view strings) noexcept
+		: file_{std::move(file)},
+		  enemies_{enemies},
+		  towers_{towers},
+		  strings_{strings} {}
+
+	auto Catalogue::compile(const std::filesystem::path& json, const std::filesystem::path& binary) noexcept -> bool
+	{
+		std::ifstream file{json};
+		if (not file.is_open())
+		{
+			return false;
+		}
+
+		const auto config = nlohmann::json::parse(file, nullptr, false);
+		if (config.is_discarded() or not config.is_object())
+		{
+			logger::error("无法解析目录: {}", json.string());
+			return false;
+		}
+
+		StringTable strings;
+		std::vector<EnemyRecord> enemies;
+		std::vector<TowerRecord> towers;
+
+		if (const auto it = config.find("enemies");
+			it != config.end() and it->is_array())
+		{
+			enemies.reserve(it->size());
+			for (const auto& enemy: *it)
+			{
+				if (not enemy.is_object())
+				{
+					logger::warning("目录中的敌人定义不是对象,已跳过");
+					continue;
+				}
+
+				enemies.push_back(::enemy_of(enemy, strings));
+			}
+		}
+
+		if (const auto it = config.find("towers");
+			it != config.end() and it->is_array())
+		{
+			towers.reserve(it->size());
+			for (const auto& tower: *it)
+			{
+				if (not tower.is_object())
+				{
+					logger::warning("目录中的塔定义不是对象,已跳过");
+					continue;
+				}
+
+				towers.push_back(::tower_of(tower, strings));
+			}
+		}
+
+		sort_records(enemies, "敌人");
+		sort_records(towers, "塔");
+
+		Header header
+		{
+				.magic = magic,
+				.version = version,
+				.enemy_count = static_cast<std::uint32_t>(enemies.size()),
+				.tower_count = static_cast<std::uint32_t>(towers.size()),
+				.enemy_offset = 0,
+				.tower_offset = 0,
+				.string_offset = 0,
+				.string_size = strings.strings.size(),
+		};
+		header.enemy_offset = align(sizeof(Header));
+		header.tower_offset = align(header.enemy_offset + enemies.size() * sizeof(EnemyRecord));
+		header.string_offset = align(header.tower_offset + towers.size() * sizeof(TowerRecord));
+
+		std::vector<std::byte> bytes(header.string_offset + header.string_size);
+		std::memcpy(bytes.data(), &header, sizeof(Header));
+		std::memcpy(bytes.data() + header.enemy_offset, enemies.data(), enemies.size() * sizeof(EnemyRecord));
+		std::memcpy(bytes.data() + header.tower_offset, towers.data(), towers.size() * sizeof(TowerRecord));
+		std::memcpy(bytes.data() + header.string_offset, strings.strings.data(), strings.strings.size());
+
+		if (not utility::write_file(binary, bytes))
+		{
+			logger::error("无法写入目录: {}", binary.string());
+			return false;
+		}
+
+		logger::info("编译目录: {} ({}个敌人, {}个塔)", binary.string(), enemies.size(), towers.size());
+		return true;
+	}
+
+	auto Catalogue::load(const std::filesystem::path& binary) noexcept -> std::optional<Catalogue>
+	{
+		auto file = utility::MappedFile::open(binary);
+		if (not file.has_value())
+		{
+			return std::nullopt;
+		}
+
+		const auto bytes = file->bytes();
+		if (bytes.size() < sizeof(Header))
+		{
+			return std::nullopt;
+		}
+
+		Header header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		std::memcpy(&header, bytes.data(), sizeof(Header));
+
+		if (header.magic != magic or header.version != version)
+		{
+			return std::nullopt;
+		}
+
+		const auto enemies = span_of<EnemyRecord>(bytes, header.enemy_offset, header.enemy_count);
+		const auto towers = span_of<TowerRecord>(bytes, header.tower_offset, header.tower_count);
+		if (not enemies.has_value() or not towers.has_value())
+		{
+			return std::nullopt;
+		}
+
+		if (header.string_offset > bytes.size() or bytes.size() - header.string_offset < header.string_size)
+		{
+			return std::nullopt;
+		}
+
+		const std::string_view strings{reinterpret_cast<const char*>(bytes.data() + header.string_offset), header.string_size}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+		// 载入时检查所有字符串的范围(string_of不再检查)以及帧是否有效
+		const auto valid_string = [&strings](const String string) noexcept -> bool
+		{
+			return string.offset <= strings.size() and strings.size() - string.offset >= string.size;
+		};
+		const auto valid =
+				std::ranges::all_of(
+					*enemies,
+					[&](const EnemyRecord& enemy) noexcept -> bool
+					{
+						return valid_string(enemy.name) and valid_string(enemy.sprite.texture) and valid_sprite(enemy.sprite);
+					}
+				) and
+				std::ranges::all_of(
+					*towers,
+					[&](const TowerRecord& tower) noexcept -> bool
+					{
+						return valid_string(tower.name) and valid_string(tower.sprite.texture) and valid_sprite(tower.sprite);
+					}
+				);
+		if (not valid)
+		{
+			return std::nullopt;
+		}
+
+		return Catalogue{*std::move(file), *enemies, *towers, strings};
+	}
+
+	auto Catalogue::open(const std::string_view name) noexcept -> std::optional<Catalogue>
+	{
+		const auto json = Path::config(name);
+		auto binary = json;
+		binary.replace_extension(".bin");
+
+		std::error_code error_code;
+		const auto json_exists = std::filesystem::exists(json, error_code);
+
+		if (json_exists)
+		{
+			const auto binary_time = std::filesystem::last_write_time(binary, error_code);
+			if (error_code or binary_time < std::filesystem::last_write_time(json, error_code))
+			{
+				// 二进制文件不存在或已过期
+				std::ignore = compile(json, binary);
+			}
+		}
+
+		if (auto catalogue = load(binary);
+			catalogue.has_value())
+		{
+			return catalogue;
+		}
+
+		// 二进制文件损坏或版本不匹配
+		if (json_exists and compile(json, binary))
+		{
+			return load(binary);
+		}
+
+		logger::error("无法载入目录: {}", binary.string());
+		return std::nullopt;
+	}
+
+	auto Catalogue::enemy_of(const components::combat::Type type) const noexcept -> const EnemyRecord*
+	{
+		return find_record(enemies_, type);
+	}
+
+	auto Catalogue::tower_of(const components::combat::Type type) const noexcept -> const TowerRecord*
+	{
+		return find_record(towers_, type);
+	}
+
+	auto Catalogue::string_of(const String string) const noexcept -> std::string_view
+	{
+		// 范围已在load中检查
+		return {strings_.data() + string.offset, string.size};
+	}
+}
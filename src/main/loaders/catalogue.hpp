@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include <components/combat/unit.hpp>
+
+#include <utility/mapped_file.hpp>
+
+namespace loaders
+{
+	// 敌人/塔定义目录
+	// 使用JSON编写,编译为可直接内存映射的二进制文件:
+	// [Header][EnemyRecord...][TowerRecord...][字符串表]
+	// 所有记录按照类型排序,运行时直接在映射的内存中二分查找
+	class Catalogue
+	{
+	public:
+		// "TDCA"
+		constexpr static std::uint32_t magic = 0x4143'4454;
+		// 记录布局发生变化时递增
+		constexpr static std::uint32_t version = 1;
+
+		using type_type = components::combat::type_underlying_type;
+
+		// 字符串表中的字符串
+		class String
+		{
+		public:
+			std::uint32_t offset;
+			std::uint32_t size;
+		};
+
+		class Header
+		{
+		public:
+			std::uint32_t magic;
+			std::uint32_t version;
+
+			std::uint32_t enemy_count;
+			std::uint32_t tower_count;
+
+			std::uint64_t enemy_offset;
+			std::uint64_t tower_offset;
+
+			std::uint64_t string_offset;
+			std::uint64_t string_size;
+		};
+
+		// 精灵帧动画(统一大小矩形帧)
+		class Sprite
+		{
+		public:
+			String texture;
+			// 纹理名称的哈希值(entt::hashed_string)
+			std::uint32_t texture_id;
+
+			float scale;
+
+			std::int32_t frame_width;
+			std::int32_t frame_height;
+			std::uint32_t frame_count;
+			// 秒
+			float frame_duration;
+			std::uint32_t looping;
+		};
+
+		class EnemyRecord
+		{
+		public:
+			type_type type;
+			String name;
+
+			Sprite sprite;
+
+			// enemy::Archetype
+			std::uint32_t archetype;
+
+			float health;
+			float speed;
+			float speed_variance;
+			std::uint32_t power;
+			std::uint32_t power_variance;
+		};
+
+		class TowerRecord
+		{
+		public:
+			type_type type;
+			String name;
+
+			Sprite sprite;
+
+			float range;
+			float fire_rate;
+			// enemy::Archetype
+			std::uint32_t targeting;
+		};
+
+	private:
+		utility::MappedFile file_;
+
+		std::span<const EnemyRecord> enemies_;
+		std::span<const TowerRecord> towers_;
+		std::string_view strings_;
+
+		Catalogue(utility::MappedFile file, std::span<const EnemyRecord> enemies, std::span<const TowerRecord> towers, std::string_view strings) noexcept;
+
+	public:
+		// 将JSON目录编译为二进制目录
+		[[nodiscard]] static auto compile(const std::filesystem::path& json, const std::filesystem::path& binary) noexcept -> bool;
+
+		// 映射二进制目录,文件无效(或版本不匹配)时返回nullopt
+		[[nodiscard]] static auto load(const std::filesystem::path& binary) noexcept -> std::optional<Catalogue>;
+
+		// 载入配置目录下的指定目录(name.json -> name.bin)
+		// 二进制文件不存在或比JSON旧时重新编译
+		[[nodiscard]] static auto open(std::string_view name) noexcept -> std::optional<Catalogue>;
+
+		[[nodiscard]] auto enemies() const noexcept -> std::span<const EnemyRecord>
+		{
+			return enemies_;
+		}
+
+		[[nodiscard]] auto towers() const noexcept -> std::span<const TowerRecord>
+		{
+			return towers_;
+		}
+
+		// 查找指定类型的敌人定义,不存在时返回nullptr
+		[[nodiscard]] auto enemy_of(components::combat::Type type) const noexcept -> const EnemyRecord*;
+
+		// 查找指定类型的塔定义,不存在时返回nullptr
+		[[nodiscard]] auto tower_of(components::combat::Type type) const noexcept -> const TowerRecord*;
+
+		[[nodiscard]] auto string_of(String string) const noexcept -> std::string_view;
+	};
+}
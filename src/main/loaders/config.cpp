@@ -1,39 +1,60 @@
 #include <loaders/config.hpp>
 
+#include <unordered_map>
+#include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <ranges>
 
 #include <loaders/path.hpp>
 
+#include <utility/mapped_file.hpp>
+#include <utility/write_file.hpp>
+
+#include <logger/logger.hpp>
+
 #include <nlohmann/json.hpp>
 
 namespace
 {
 	using namespace loaders;
 
-	[[nodiscard]] auto load_config_file(const Config::Category category) noexcept -> std::optional<nlohmann::json>
+	// 已解析的配置文件
+	class Document
+	{
+	public:
+		std::shared_ptr<nlohmann::json> json;
+		// 解析时JSON文件的修改时间
+		std::filesystem::file_time_type write_time;
+	};
+
+	std::mutex documents_mutex;
+	// 配置文件路径 => 文档
+	std::unordered_map<std::filesystem::path, Document> documents;
+
+	[[nodiscard]] auto path_of(const Config::Category category) noexcept -> std::filesystem::path
 	{
-		const auto file_path = [category]
+		using enum Config::Category;
+		switch (category)
 		{
-			using enum Config::Category;
-			switch (category)
+			case SYSTEM:
 			{
-				case SYSTEM:
-				{
-					return Path::config("system-config");
-				}
-				case WINDOW:
-				{
-					return Path::config("window-config");
-				}
-				default: // NOLINT(clang-diagnostic-covered-switch-default)
-				{
-					std::unreachable();
-				}
+				return Path::config("system-config");
 			}
-		}();
+			case WINDOW:
+			{
+				return Path::config("window-config");
+			}
+			default: // NOLINT(clang-diagnostic-covered-switch-default)
+			{
+				std::unreachable();
+			}
+		}
+	}
 
-		std::ifstream file{file_path};
+	[[nodiscard]] auto parse_json(const std::filesystem::path& path) noexcept -> std::optional<nlohmann::json>
+	{
+		std::ifstream file{path};
 
 		if (not file.is_open())
 		{
@@ -50,15 +71,94 @@ namespace
 		return config;
 	}
 
+	[[nodiscard]] auto parse_cbor(const std::filesystem::path& path) noexcept -> std::optional<nlohmann::json>
+	{
+		const auto file = utility::MappedFile::open(path);
+		if (not file.has_value())
+		{
+			return std::nullopt;
+		}
+
+		const auto* begin = reinterpret_cast<const std::uint8_t*>(file->data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		auto config = nlohmann::json::from_cbor(begin, begin + file->size(), true, false);
+
+		if (config.is_discarded())
+		{
+			return std::nullopt;
+		}
+
+		return config;
+	}
+
+	auto write_cbor(const std::filesystem::path& path, const nlohmann::json& config) noexcept -> void
+	{
+		const auto bytes = nlohmann::json::to_cbor(config);
+
+		if (not utility::write_file(path, std::as_bytes(std::span{bytes})))
+		{
+			logger::warning("无法写入配置缓存: {}", path.string());
+		}
+	}
+
+	// 载入配置文件,CBOR缓存比JSON新时直接载入缓存
+	[[nodiscard]] auto load_document(const std::filesystem::path& json_path, const std::filesystem::file_time_type json_time) noexcept -> std::shared_ptr<nlohmann::json>
+	{
+		auto cbor_path = json_path;
+		cbor_path.replace_extension(".cbor");
+
+		std::error_code error_code;
+		if (const auto cbor_time = std::filesystem::last_write_time(cbor_path, error_code);
+			not error_code and cbor_time >= json_time)
+		{
+			if (auto config = parse_cbor(cbor_path);
+				config.has_value())
+			{
+				return std::make_shared<nlohmann::json>(*std::move(config));
+			}
+		}
+
+		auto config = parse_json(json_path);
+		if (not config.has_value())
+		{
+			return nullptr;
+		}
+
+		write_cbor(cbor_path, *config);
+
+		return std::make_shared<nlohmann::json>(*std::move(config));
+	}
+
+	// 获取配置文件,文件修改后重新载入
+	[[nodiscard]] auto document_of(const std::filesystem::path& path) noexcept -> std::shared_ptr<nlohmann::json>
+	{
+		std::error_code error_code;
+		const auto write_time = std::filesystem::last_write_time(path, error_code);
+		if (error_code)
+		{
+			return nullptr;
+		}
+
+		std::scoped_lock lock{documents_mutex};
+
+		auto& [json, document_write_time] = documents[path];
+		if (json == nullptr or document_write_time != write_time)
+		{
+			json = load_document(path, write_time);
+			document_write_time = write_time;
+		}
+
+		return json;
+	}
+
 	template<typename T>
-	[[nodiscard]] auto get_config(const nlohmann::json& json, const std::span<T> names) noexcept -> std::optional<nlohmann::json>
+	[[nodiscard]] auto get_config(nlohmann::json& json, const std::span<T> names) noexcept -> nlohmann::json*
 	{
 		assert(not names.empty());
 
 		auto iterator = json.find(names.front());
 		if (iterator == json.end())
 		{
-			return std::nullopt;
+			return nullptr;
 		}
 
 		for (const auto& name: names | std::views::drop(1))
@@ -66,25 +166,32 @@ namespace
 			if (iterator = iterator.value().find(name);
 				iterator == json.end())
 			{
-				return std::nullopt;
+				return nullptr;
 			}
 		}
 
-		return iterator.value();
+		return &iterator.value();
 	}
 
 	template<typename T>
-	[[nodiscard]] auto load_and_get_config(const Config::Category category, const std::span<T> names) noexcept -> std::optional<nlohmann::json>
+	[[nodiscard]] auto load_and_get_config(const std::filesystem::path& path, const std::span<T> names) noexcept -> Config::result_type
 	{
 		assert(not names.empty());
 
-		const auto config_file = load_config_file(category);
-		if (not config_file.has_value())
+		auto document = document_of(path);
+		if (document == nullptr)
 		{
-			return std::nullopt;
+			return nullptr;
 		}
 
-		return ::get_config<T>(*config_file, names);
+		auto* config = ::get_config<T>(*document, names);
+		if (config == nullptr)
+		{
+			return nullptr;
+		}
+
+		// 与文档共享所有权,文档重新载入后旧的结果依然有效
+		return {std::move(document), config};
 	}
 }
 
@@ -92,51 +199,46 @@ namespace loaders
 {
 	auto Config::operator()(const Category category, const std::string_view name) noexcept -> result_type
 	{
-		if (auto config = load_and_get_config(category, std::span{&name, 1});
-			config.has_value())
-		{
-			return std::make_shared<nlohmann::json>(*std::move(config));
-		}
-
-		return nullptr;
+		return load_and_get_config(path_of(category), std::span{&name, 1});
 	}
 
 	auto Config::operator()(const Category category, const std::span<const char*> names) noexcept -> result_type
 	{
 		assert(not names.empty());
 
-		if (auto config = load_and_get_config(category, names);
-			config.has_value())
-		{
-			return std::make_shared<nlohmann::json>(*std::move(config));
-		}
-
-		return nullptr;
+		return load_and_get_config(path_of(category), names);
 	}
 
 	auto Config::operator()(const Category category, const std::span<const std::string_view> names) noexcept -> result_type
 	{
 		assert(not names.empty());
 
-		if (auto config = load_and_get_config(category, names);
-			config.has_value())
-		{
-			return std::make_shared<nlohmann::json>(*std::move(config));
-		}
-
-		return nullptr;
+		return load_and_get_config(path_of(category), names);
 	}
 
 	auto Config::operator()(const Category category, const std::span<const std::string> names) noexcept -> result_type
 	{
 		assert(not names.empty());
 
-		if (auto config = load_and_get_config(category, names);
-			config.has_value())
-		{
-			return std::make_shared<nlohmann::json>(*std::move(config));
-		}
+		return load_and_get_config(path_of(category), names);
+	}
+
+	auto Config::load(const std::filesystem::path& path, const std::span<const std::string_view> names) noexcept -> result_type
+	{
+		assert(not names.empty());
+
+		return load_and_get_config(path, names);
+	}
+
+	auto Config::reload(const std::filesystem::path& path) noexcept -> bool
+	{
+		return document_of(path) != nullptr;
+	}
+
+	auto Config::clear() noexcept -> void
+	{
+		std::scoped_lock lock{documents_mutex};
 
-		return nullptr;
+		documents.clear();
 	}
 }
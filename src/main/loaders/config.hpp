@@ -1,5 +1,6 @@
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <span>
@@ -8,6 +9,9 @@
 
 namespace loaders
 {
+	// 每个类别的配置文件只解析一次,文件修改后重新解析
+	// 查询结果与解析后的文档共享所有权,指向文档内部的节点(不复制)
+	// 解析JSON后同时写出CBOR缓存(name.cbor),之后JSON未修改时直接载入CBOR
 	class Config
 	{
 	public:
@@ -28,5 +32,15 @@ namespace loaders
 		[[nodiscard]] static auto operator()(Category category, std::span<const std::string_view> names) noexcept -> result_type;
 
 		[[nodiscard]] static auto operator()(Category category, std::span<const std::string> names) noexcept -> result_type;
+
+		// 在指定的配置文件中查询(同样使用缓存)
+		[[nodiscard]] static auto load(const std::filesystem::path& path, std::span<const std::string_view> names) noexcept -> result_type;
+
+		// 重新解析指定的配置文件(文件修改后调用,之后的查询无需再次解析)
+		// 可以在任意线程调用
+		static auto reload(const std::filesystem::path& path) noexcept -> bool;
+
+		// 丢弃所有已解析的文档(已经返回的结果仍然有效)
+		static auto clear() noexcept -> void;
 	};
 }
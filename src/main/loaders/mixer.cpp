@@ -0,0 +1,200 @@
+#include <loaders/mixer.hpp>
+
+#include <algorithm>
+
+#include <loaders/sound.hpp>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+
+namespace loaders
+{
+	Mixer::Mixer() noexcept
+		: voices_(voice_capacity),
+		  sequence_{0},
+		  random_{std::random_device{}()}
+	{
+		pending_.reserve(voice_capacity);
+	}
+
+	auto Mixer::voice_of(const SoundResource& resource) noexcept -> Voice*
+	{
+		Voice* free_voice = nullptr;
+		// 同一音效最早开始的声音
+		Voice* oldest_same = nullptr;
+		std::size_t same_count = 0;
+		// 优先级最低(相同时最早开始)的声音
+		Voice* victim = nullptr;
+
+		for (auto& voice: voices_)
+		{
+			if (voice.owner == nullptr)
+			{
+				if (free_voice == nullptr)
+				{
+					free_voice = &voice;
+				}
+				continue;
+			}
+
+			if (voice.owner == &resource)
+			{
+				same_count += 1;
+				if (oldest_same == nullptr or voice.sequence < oldest_same->sequence)
+				{
+					oldest_same = &voice;
+				}
+			}
+
+			if (victim == nullptr or voice.priority < victim->priority or (voice.priority == victim->priority and voice.sequence < victim->sequence))
+			{
+				victim = &voice;
+			}
+		}
+
+		// 达到该音效的并发上限,重新开始其最早的声音
+		if (same_count >= resource.max_voices())
+		{
+			return oldest_same;
+		}
+
+		if (free_voice != nullptr)
+		{
+			return free_voice;
+		}
+
+		// 不抢占优先级更高的声音
+		if (victim != nullptr and victim->priority <= resource.priority())
+		{
+			return victim;
+		}
+
+		return nullptr;
+	}
+
+	auto Mixer::global() noexcept -> Mixer&
+	{
+		static Mixer mixer{};
+		return mixer;
+	}
+
+	auto Mixer::play(const SoundResource& resource, const float gain, const bool pitch) noexcept -> void
+	{
+		if (const auto it = std::ranges::find(pending_, &resource, &Pending::owner);
+			it != pending_.end())
+		{
+			it->gain = std::ranges::max(it->gain, gain);
+			it->pitch = it->pitch or pitch;
+			return;
+		}
+
+		pending_.emplace_back(&resource, gain, pitch);
+	}
+
+	auto Mixer::update() noexcept -> void
+	{
+		// 回收播放完成的声音(最多voice_capacity个,与播放频率无关)
+		for (auto& voice: voices_)
+		{
+			if (voice.owner != nullptr and voice.sound->getStatus() == sf::Sound::Status::Stopped)
+			{
+				voice.owner = nullptr;
+			}
+		}
+
+		// 优先级高的音效先选择声音
+		std::ranges::stable_sort(
+			pending_,
+			std::ranges::greater{},
+			[](const Pending& pending) noexcept -> std::uint8_t
+			{
+				return pending.owner->priority();
+			}
+		);
+
+		for (const auto [owner, gain, pitch]: pending_)
+		{
+			const auto volume = std::ranges::min(owner->volume() * gain, SoundResource::max_volume);
+			if (volume <= SoundResource::min_volume)
+			{
+				continue;
+			}
+
+			auto* voice = voice_of(*owner);
+			if (voice == nullptr)
+			{
+				continue;
+			}
+
+			if (voice->sound.has_value())
+			{
+				voice->sound->stop();
+				voice->sound->setBuffer(owner->buffer());
+			}
+			else
+			{
+				voice->sound.emplace(owner->buffer());
+			}
+
+			voice->sound->setVolume(volume);
+			if (pitch)
+			{
+				std::uniform_real_distribution<float> distribution{0, 50};
+				voice->sound->setPitch((75.f + distribution(random_)) / 100.f);
+			}
+			else
+			{
+				voice->sound->setPitch(1.f);
+			}
+			voice->sound->play();
+
+			voice->owner = owner;
+			voice->gain = gain;
+			voice->priority = owner->priority();
+			voice->sequence = sequence_++;
+		}
+
+		pending_.clear();
+	}
+
+	auto Mixer::stop(const SoundResource& resource) noexcept -> void
+	{
+		std::erase_if(
+			pending_,
+			[&](const Pending& pending) noexcept -> bool
+			{
+				return pending.owner == &resource;
+			}
+		);
+
+		for (auto& voice: voices_)
+		{
+			if (voice.owner == &resource)
+			{
+				voice.sound->stop();
+				voice.owner = nullptr;
+			}
+		}
+	}
+
+	auto Mixer::set_volume(const SoundResource& resource, const float volume) noexcept -> void
+	{
+		for (auto& voice: voices_)
+		{
+			if (voice.owner == &resource)
+			{
+				voice.sound->setVolume(std::ranges::min(volume * voice.gain, SoundResource::max_volume));
+			}
+		}
+	}
+
+	auto Mixer::active() const noexcept -> std::size_t
+	{
+		return std::ranges::count_if(
+			voices_,
+			[](const Voice& voice) noexcept -> bool
+			{
+				return voice.owner != nullptr;
+			}
+		);
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <SFML/Audio/Sound.hpp>
+
+namespace loaders
+{
+	class SoundResource;
+
+	// 全局混音器
+	// 固定数量的声音对象循环使用,播放不会分配新的声音
+	// 同一帧内对同一音效的多次播放合并为一次,在update中统一播放
+	// 没有空闲的声音时按照优先级(相同时选择最早开始的)抢占
+	class Mixer
+	{
+	public:
+		// 同时播放的声音数量上限(OpenAL通常最多支持256个音源)
+		constexpr static std::size_t voice_capacity = 32;
+
+		Mixer(const Mixer&) noexcept = delete;
+		Mixer(Mixer&&) noexcept = delete;
+		auto operator=(const Mixer&) noexcept -> Mixer& = delete;
+		auto operator=(Mixer&&) noexcept -> Mixer& = delete;
+
+	private:
+		class Voice
+		{
+		public:
+			// 第一次使用时创建,之后只替换音效数据
+			std::optional<sf::Sound> sound;
+
+			// 正在播放的音效(nullptr表示空闲)
+			const SoundResource* owner;
+			// 音量倍数
+			float gain;
+			std::uint8_t priority;
+			// 开始播放的顺序(越小越早)
+			std::uint64_t sequence;
+		};
+
+		class Pending
+		{
+		public:
+			const SoundResource* owner;
+			// 音量倍数
+			float gain;
+			// 是否随机音调
+			bool pitch;
+		};
+
+		std::vector<Voice> voices_;
+		// 本帧请求播放的音效(每个音效最多一个)
+		std::vector<Pending> pending_;
+
+		std::uint64_t sequence_;
+		std::mt19937 random_;
+
+		Mixer() noexcept;
+
+		// 为音效选择一个声音,没有可用的声音时返回nullptr
+		[[nodiscard]] auto voice_of(const SoundResource& resource) noexcept -> Voice*;
+
+	public:
+		[[nodiscard]] static auto global() noexcept -> Mixer&;
+
+		// 请求播放音效(本帧内的多次请求合并为一次,使用最大的音量倍数)
+		auto play(const SoundResource& resource, float gain, bool pitch) noexcept -> void;
+
+		// 回收播放完成的声音并播放本帧请求的音效(每帧调用一次)
+		auto update() noexcept -> void;
+
+		// 停止音效的所有声音(音效数据即将被替换或销毁)
+		auto stop(const SoundResource& resource) noexcept -> void;
+
+		// 更新音效所有正在播放的声音的音量
+		auto set_volume(const SoundResource& resource, float volume) noexcept -> void;
+
+		// 正在播放的声音数量
+		[[nodiscard]] auto active() const noexcept -> std::size_t;
+	};
+}
@@ -1,5 +1,6 @@
 #include <loaders/music.hpp>
 
+#include <loaders/pack.hpp>
 #include <loaders/path.hpp>
 
 #include <SFML/Audio.hpp>
@@ -10,6 +11,12 @@ namespace loaders
 	{
 		const auto absolute_path = Path::music(filename_without_extension);
 
+		// 优先从资源包中载入(音乐是流式播放的,资源包在程序运行期间一直保持映射)
+		if (const auto bytes = Pack::find_media(absolute_path); bytes.has_value())
+		{
+			return operator()(bytes->data(), bytes->size());
+		}
+
 		if (not exists(absolute_path))
 		{
 			return nullptr;
@@ -0,0 +1,294 @@
+#include <loaders/pack.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <loaders/path.hpp>
+
+#include <utility/write_file.hpp>
+
+namespace
+{
+	using namespace loaders;
+
+	static_assert(std::is_trivially_copyable_v<Pack::Header> and std::is_standard_layout_v<Pack::Header>);
+	static_assert(std::is_trivially_copyable_v<Pack::Entry> and std::is_standard_layout_v<Pack::Entry>);
+
+	// 文件名表之前的区块按8字节对齐
+	constexpr std::uint64_t block_alignment = 8;
+	// 文件数据按16字节对齐
+	constexpr std::uint64_t blob_alignment = 16;
+
+	[[nodiscard]] constexpr auto align(const std::uint64_t offset, const std::uint64_t alignment) noexcept -> std::uint64_t
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	class Source
+	{
+	public:
+		std::string name;
+		std::filesystem::path path;
+		std::uint64_t size;
+	};
+
+	auto write_padding(std::ostream& out, const std::uint64_t from, const std::uint64_t to) noexcept -> void
+	{
+		constexpr std::array<char, blob_alignment> zeros{};
+
+		out.write(zeros.data(), static_cast<std::streamsize>(to - from));
+	}
+}
+
+namespace loaders
+{
+	PackStream::PackStream(const std::span<const std::byte> bytes) noexcept
+		: bytes_{bytes},
+		  position_{0} {}
+
+	auto PackStream::read(void* data, const std::size_t size) -> std::optional<std::size_t>
+	{
+		const auto count = std::ranges::min(size, bytes_.size() - position_);
+
+		std::memcpy(data, bytes_.data() + position_, count);
+		position_ += count;
+
+		return count;
+	}
+
+	auto PackStream::seek(const std::size_t position) -> std::optional<std::size_t>
+	{
+		position_ = std::ranges::min(position, bytes_.size());
+
+		return position_;
+	}
+
+	auto PackStream::tell() -> std::optional<std::size_t>
+	{
+		return position_;
+	}
+
+	auto PackStream::getSize() -> std::optional<std::size_t>
+	{
+		return bytes_.size();
+	}
+
+	Pack::Pack(utility::MappedFile file, const std::span<const Entry> entries, const std::string_view strings) noexcept
+		: file_{std::move(file)},
+		  entries_{entries},
+		  strings_{strings} {}
+
+	auto Pack::build(const std::filesystem::path& directory, const std::filesystem::path& pack) noexcept -> bool
+	{
+		std::error_code error_code;
+
+		std::vector<Source> sources;
+		for (auto it = std::filesystem::recursive_directory_iterator{directory, error_code}; not error_code and it != std::filesystem::recursive_directory_iterator{}; it.increment(error_code))
+		{
+			if (not it->is_regular_file(error_code))
+			{
+				continue;
+			}
+
+			const auto size = it->file_size(error_code);
+			if (error_code)
+			{
+				return false;
+			}
+
+			sources.emplace_back(it->path().lexically_relative(directory).generic_string(), it->path(), size);
+		}
+		if (error_code)
+		{
+			return false;
+		}
+
+		std::ranges::sort(sources, std::ranges::less{}, &Source::name);
+
+		std::string strings;
+		std::vector<Entry> entries;
+		entries.reserve(sources.size());
+
+		Header header
+		{
+				.magic = magic,
+				.version = version,
+				.entry_count = static_cast<std::uint32_t>(sources.size()),
+				.reserved = 0,
+				.entry_offset = align(sizeof(Header), block_alignment),
+				.string_offset = 0,
+				.string_size = 0,
+		};
+
+		for (const auto& source: sources)
+		{
+			entries.push_back(
+				{
+						.name = {.offset = static_cast<std::uint32_t>(strings.size()), .size = static_cast<std::uint32_t>(source.name.size())},
+						.compression = Compression::NONE,
+						.reserved = 0,
+						.offset = 0,
+						.stored_size = source.size,
+						.size = source.size,
+				}
+			);
+			strings.append(source.name);
+		}
+
+		header.string_offset = header.entry_offset + entries.size() * sizeof(Entry);
+		header.string_size = strings.size();
+
+		// 计算所有文件数据的位置
+		auto offset = header.string_offset + header.string_size;
+		for (auto& entry: entries)
+		{
+			entry.offset = align(offset, blob_alignment);
+			offset = entry.offset + entry.stored_size;
+		}
+
+		return utility::write_file(
+			pack,
+			[&](std::ostream& out) noexcept -> bool
+			{
+				out.write(reinterpret_cast<const char*>(&header), sizeof(Header)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+				write_padding(out, sizeof(Header), header.entry_offset);
+				out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(Entry))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+				out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+				auto position = header.string_offset + header.string_size;
+				std::vector<char> buffer;
+				for (std::size_t i = 0; i < sources.size(); ++i)
+				{
+					const auto& source = sources[i];
+					const auto& entry = entries[i];
+
+					write_padding(out, position, entry.offset);
+
+					std::ifstream in{source.path, std::ios::binary};
+					buffer.resize(entry.stored_size);
+					if (not in.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+					{
+						return false;
+					}
+
+					out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+					position = entry.offset + entry.stored_size;
+				}
+
+				return not out.fail();
+			}
+		);
+	}
+
+	auto Pack::open(const std::filesystem::path& pack) noexcept -> std::optional<Pack>
+	{
+		auto file = utility::MappedFile::open(pack);
+		if (not file.has_value())
+		{
+			return std::nullopt;
+		}
+
+		const auto bytes = file->bytes();
+		if (bytes.size() < sizeof(Header))
+		{
+			return std::nullopt;
+		}
+
+		Header header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		std::memcpy(&header, bytes.data(), sizeof(Header));
+
+		if (header.magic != magic or header.version != version)
+		{
+			return std::nullopt;
+		}
+
+		if (
+			header.entry_offset % alignof(Entry) != 0 or
+			header.entry_offset > bytes.size() or (bytes.size() - header.entry_offset) / sizeof(Entry) < header.entry_count or
+			header.string_offset > bytes.size() or bytes.size() - header.string_offset < header.string_size
+		)
+		{
+			return std::nullopt;
+		}
+
+		// 文件由build生成,布局与内存布局一致
+		const std::span entries{reinterpret_cast<const Entry*>(bytes.data() + header.entry_offset), header.entry_count}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		const std::string_view strings{reinterpret_cast<const char*>(bytes.data() + header.string_offset), header.string_size}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+		// 所有条目都必须位于文件内
+		const auto valid = std::ranges::all_of(
+			entries,
+			[&](const Entry& entry) noexcept -> bool
+			{
+				return
+						entry.name.offset <= strings.size() and strings.size() - entry.name.offset >= entry.name.size and
+						entry.offset <= bytes.size() and bytes.size() - entry.offset >= entry.stored_size;
+			}
+		);
+		if (not valid)
+		{
+			return std::nullopt;
+		}
+
+		return Pack{*std::move(file), entries, strings};
+	}
+
+	auto Pack::media() noexcept -> const Pack*
+	{
+		static const auto pack = open(Path::media_pack());
+
+		return pack.has_value() ? std::addressof(*pack) : nullptr;
+	}
+
+	auto Pack::find_media(const std::filesystem::path& absolute_path) noexcept -> std::optional<std::span<const std::byte>>
+	{
+		const auto* pack = media();
+		if (pack == nullptr)
+		{
+			return std::nullopt;
+		}
+
+		const auto relative_path = absolute_path.lexically_relative(Path::texture());
+		if (relative_path.empty() or *relative_path.begin() == "..")
+		{
+			return std::nullopt;
+		}
+
+		return pack->find(relative_path.generic_string());
+	}
+
+	auto Pack::name_of(const Entry& entry) const noexcept -> std::string_view
+	{
+		return strings_.substr(entry.name.offset, entry.name.size);
+	}
+
+	auto Pack::find(const std::string_view name) const noexcept -> std::optional<std::span<const std::byte>>
+	{
+		const auto it = std::ranges::lower_bound(
+			entries_,
+			name,
+			std::ranges::less{},
+			[this](const Entry& entry) noexcept -> std::string_view
+			{
+				return name_of(entry);
+			}
+		);
+
+		if (it == entries_.end() or name_of(*it) != name)
+		{
+			return std::nullopt;
+		}
+
+		// 暂不支持压缩
+		if (it->compression != Compression::NONE)
+		{
+			return std::nullopt;
+		}
+
+		return file_.bytes().subspan(it->offset, it->stored_size);
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include <utility/mapped_file.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+namespace loaders
+{
+	// 资源包中单个文件的输入流(直接读取映射的内存,不复制)
+	class PackStream final : public sf::InputStream
+	{
+		std::span<const std::byte> bytes_;
+		std::size_t position_;
+
+	public:
+		explicit PackStream(std::span<const std::byte> bytes) noexcept;
+
+		[[nodiscard]] auto read(void* data, std::size_t size) -> std::optional<std::size_t> override;
+
+		[[nodiscard]] auto seek(std::size_t position) -> std::optional<std::size_t> override;
+
+		[[nodiscard]] auto tell() -> std::optional<std::size_t> override;
+
+		[[nodiscard]] auto getSize() -> std::optional<std::size_t> override;
+	};
+
+	// 资源包
+	// [Header][Entry...][文件名表][文件数据(按16字节对齐)...]
+	// 所有条目按照文件名(相对于打包目录,使用'/'分隔)排序,运行时直接在映射的内存中二分查找
+	class Pack
+	{
+	public:
+		// "TDPK"
+		constexpr static std::uint32_t magic = 0x4b50'4454;
+		// 布局发生变化时递增
+		constexpr static std::uint32_t version = 1;
+
+		enum class Compression : std::uint32_t
+		{
+			NONE = 0,
+			// 预留,目前打包时不会压缩,读取时视为无效条目
+			LZ4 = 1,
+		};
+
+		class String
+		{
+		public:
+			std::uint32_t offset;
+			std::uint32_t size;
+		};
+
+		class Header
+		{
+		public:
+			std::uint32_t magic;
+			std::uint32_t version;
+
+			std::uint32_t entry_count;
+			std::uint32_t reserved;
+
+			std::uint64_t entry_offset;
+
+			std::uint64_t string_offset;
+			std::uint64_t string_size;
+		};
+
+		class Entry
+		{
+		public:
+			String name;
+
+			Compression compression;
+			std::uint32_t reserved;
+
+			std::uint64_t offset;
+			// 压缩后的大小
+			std::uint64_t stored_size;
+			// 原始大小
+			std::uint64_t size;
+		};
+
+	private:
+		utility::MappedFile file_;
+
+		std::span<const Entry> entries_;
+		std::string_view strings_;
+
+		Pack(utility::MappedFile file, std::span<const Entry> entries, std::string_view strings) noexcept;
+
+	public:
+		// 将目录下的所有文件打包
+		[[nodiscard]] static auto build(const std::filesystem::path& directory, const std::filesystem::path& pack) noexcept -> bool;
+
+		// 映射资源包,文件无效(或版本不匹配)时返回nullopt
+		[[nodiscard]] static auto open(const std::filesystem::path& pack) noexcept -> std::optional<Pack>;
+
+		// media目录对应的资源包(不存在时返回nullptr)
+		[[nodiscard]] static auto media() noexcept -> const Pack*;
+
+		// 在media资源包中查找指定文件(absolute_path位于media目录中)
+		[[nodiscard]] static auto find_media(const std::filesystem::path& absolute_path) noexcept -> std::optional<std::span<const std::byte>>;
+
+		[[nodiscard]] auto entries() const noexcept -> std::span<const Entry>
+		{
+			return entries_;
+		}
+
+		[[nodiscard]] auto name_of(const Entry& entry) const noexcept -> std::string_view;
+
+		// 查找指定文件(相对于打包目录,使用'/'分隔),不存在时返回nullopt
+		[[nodiscard]] auto find(std::string_view name) const noexcept -> std::optional<std::span<const std::byte>>;
+	};
+}
@@ -28,6 +28,22 @@ namespace loaders
 		return absolute_path;
 	}
 
+	auto Path::map() noexcept -> const std::filesystem::path&
+	{
+		static auto path = current_path() / "data" / "map";
+
+		return path;
+	}
+
+	auto Path::map(const std::string_view filename_without_extension) noexcept -> std::filesystem::path
+	{
+		std::filesystem::path path{filename_without_extension};
+		path.replace_extension(".tdmap");
+
+		auto absolute_path = map() / path;
+		return absolute_path;
+	}
+
 	auto Path::font() noexcept -> const std::filesystem::path&
 	{
 		static auto path = current_path() / "media" / "font";
@@ -44,6 +60,13 @@ namespace loaders
 		return absolute_path;
 	}
 
+	auto Path::media_pack() noexcept -> const std::filesystem::path&
+	{
+		static auto path = current_path() / "media.pack";
+
+		return path;
+	}
+
 	auto Path::texture() noexcept -> const std::filesystem::path&
 	{
 		static auto path = current_path() / "media";
@@ -99,6 +122,22 @@ namespace loaders
 		return absolute_path;
 	}
 
+	auto Path::texture_atlas() noexcept -> const std::filesystem::path&
+	{
+		static auto path = texture() / "atlas";
+
+		return path;
+	}
+
+	auto Path::texture_atlas(const std::string_view filename_without_extension) noexcept -> std::filesystem::path
+	{
+		std::filesystem::path path{filename_without_extension};
+		path.replace_extension(".png");
+
+		auto absolute_path = texture_atlas() / path;
+		return absolute_path;
+	}
+
 	auto Path::sound() noexcept -> const std::filesystem::path&
 	{
 		static auto path = current_path() / "media" / "sound";
@@ -130,4 +169,29 @@ namespace loaders
 		auto absolute_path = music() / path;
 		return absolute_path;
 	}
+
+	auto Path::save() noexcept -> const std::filesystem::path&
+	{
+		static auto path = current_path() / "save";
+
+		return path;
+	}
+
+	auto Path::save(const std::string_view filename_without_extension) noexcept -> std::filesystem::path
+	{
+		std::filesystem::path path{filename_without_extension};
+		path.replace_extension(".tdsave");
+
+		auto absolute_path = save() / path;
+		return absolute_path;
+	}
+
+	auto Path::replay(const std::string_view filename_without_extension) noexcept -> std::filesystem::path
+	{
+		std::filesystem::path path{filename_without_extension};
+		path.replace_extension(".tdreplay");
+
+		auto absolute_path = save() / path;
+		return absolute_path;
+	}
 }
@@ -13,12 +13,21 @@ namespace loaders
 		// 指定配置文件绝对路径
 		[[nodiscard]] static auto config(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
 
+		// 地图文件目录绝对路径
+		[[nodiscard]] static auto map() noexcept -> const std::filesystem::path&;
+
+		// 指定地图文件绝对路径
+		[[nodiscard]] static auto map(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
+
 		// 字体文件目录绝对路径
 		[[nodiscard]] static auto font() noexcept -> const std::filesystem::path&;
 
 		// 指定字体文件绝对路径
 		[[nodiscard]] static auto font(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
 
+		// media目录资源包绝对路径(存在时优先从资源包中载入media目录中的文件)
+		[[nodiscard]] static auto media_pack() noexcept -> const std::filesystem::path&;
+
 		// 纹理文件目录绝对路径
 		[[nodiscard]] static auto texture() noexcept -> const std::filesystem::path&;
 
@@ -40,6 +49,12 @@ namespace loaders
 		// 指定塔纹理文件绝对路径
 		[[nodiscard]] static auto texture_tower(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
 
+		// 纹理图集文件目录绝对路径
+		[[nodiscard]] static auto texture_atlas() noexcept -> const std::filesystem::path&;
+
+		// 指定纹理图集页文件绝对路径
+		[[nodiscard]] static auto texture_atlas(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
+
 		// 音效文件目录绝对路径
 		[[nodiscard]] static auto sound() noexcept -> const std::filesystem::path&;
 
@@ -51,5 +66,14 @@ namespace loaders
 
 		// 指定背景音乐文件绝对路径
 		[[nodiscard]] static auto music(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
+
+		// 存档目录绝对路径
+		[[nodiscard]] static auto save() noexcept -> const std::filesystem::path&;
+
+		// 指定存档文件绝对路径
+		[[nodiscard]] static auto save(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
+
+		// 指定回放文件绝对路径(位于存档目录)
+		[[nodiscard]] static auto replay(std::string_view filename_without_extension) noexcept -> std::filesystem::path;
 	};
 }
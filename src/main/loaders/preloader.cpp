@@ -0,0 +1,162 @@
+#include <loaders/preloader.hpp>
+
+#include <algorithm>
+#include <ranges>
+
+#include <loaders/pack.hpp>
+
+#include <logger/logger.hpp>
+
+#include <utility/thread_pool.hpp>
+
+#include <entt/resource/cache.hpp>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Clock.hpp>
+
+namespace
+{
+	// 优先从资源包中解码,资源包中不存在时从文件中解码
+	template<typename T>
+	[[nodiscard]] auto load(T& object, const std::filesystem::path& path) noexcept -> bool
+	{
+		if (const auto bytes = loaders::Pack::find_media(path); bytes.has_value())
+		{
+			loaders::PackStream stream{*bytes};
+			return object.loadFromStream(stream);
+		}
+
+		return object.loadFromFile(path);
+	}
+}
+
+namespace loaders
+{
+	Preloader::Preloader() noexcept
+		: state_{std::make_shared<State>()},
+		  finished_{0},
+		  total_{0} {}
+
+	Preloader::~Preloader() noexcept = default;
+
+	auto Preloader::texture(const entt::id_type id, std::filesystem::path path) noexcept -> void
+	{
+		texture_requests_.emplace_back(id, std::move(path));
+	}
+
+	auto Preloader::sound(const entt::id_type id, std::filesystem::path path) noexcept -> void
+	{
+		sound_requests_.emplace_back(id, std::move(path));
+	}
+
+	auto Preloader::start() noexcept -> void
+	{
+		auto& pool = utility::ThreadPool::global();
+
+		total_ = texture_requests_.size() + sound_requests_.size();
+
+		// 每个文件一个任务
+		for (auto& [id, path]: texture_requests_)
+		{
+			pool.submit(
+				[state = state_, id, path = std::move(path)]() noexcept -> void
+				{
+					auto image = std::make_unique<sf::Image>();
+					if (not load(*image, path))
+					{
+						logger::error("无法载入纹理: {}", path.string());
+						state->failed.fetch_add(1, std::memory_order_relaxed);
+						return;
+					}
+
+					std::scoped_lock lock{state->mutex};
+					state->images.emplace_back(id, std::move(image));
+				}
+			);
+		}
+
+		for (auto& [id, path]: sound_requests_)
+		{
+			pool.submit(
+				[state = state_, id, path = std::move(path)]() noexcept -> void
+				{
+					auto sound_buffer = std::make_unique<sf::SoundBuffer>();
+					if (not load(*sound_buffer, path))
+					{
+						logger::error("无法载入音效: {}", path.string());
+						state->failed.fetch_add(1, std::memory_order_relaxed);
+						return;
+					}
+
+					std::scoped_lock lock{state->mutex};
+					state->sound_buffers.emplace_back(id, std::move(sound_buffer));
+				}
+			);
+		}
+
+		texture_requests_.clear();
+		sound_requests_.clear();
+	}
+
+	auto Preloader::upload(textures_type& textures, sounds_type& sounds, const sf::Time budget) noexcept -> void
+	{
+		const sf::Clock clock{};
+
+		// 音效不需要上传,直接全部取出
+		decltype(state_->sound_buffers) sound_buffers;
+		{
+			std::scoped_lock lock{state_->mutex};
+			std::swap(sound_buffers, state_->sound_buffers);
+		}
+
+		for (auto& [id, sound_buffer]: sound_buffers)
+		{
+			std::ignore = sounds.load(id, std::move(sound_buffer));
+			finished_ += 1;
+		}
+
+		while (clock.getElapsedTime() < budget)
+		{
+			std::unique_ptr<sf::Image> image;
+			entt::id_type id;
+			{
+				std::scoped_lock lock{state_->mutex};
+				if (state_->images.empty())
+				{
+					break;
+				}
+
+				std::tie(id, image) = std::move(state_->images.back());
+				state_->images.pop_back();
+			}
+
+			// 上传到GPU
+			if (auto [it, result] = textures.load(id, *image);
+				not it->second)
+			{
+				logger::error("无法上传纹理: {}", id);
+			}
+
+			finished_ += 1;
+		}
+	}
+
+	auto Preloader::progress() const noexcept -> float
+	{
+		if (total_ == 0)
+		{
+			return 1;
+		}
+
+		const auto failed = state_->failed.load(std::memory_order_relaxed);
+
+		return std::ranges::min(static_cast<float>(finished_ + failed) / static_cast<float>(total_), 1.f);
+	}
+
+	auto Preloader::done() const noexcept -> bool
+	{
+		return finished_ + state_->failed.load(std::memory_order_relaxed) >= total_;
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <loaders/texture.hpp>
+#include <loaders/sound.hpp>
+
+#include <entt/core/fwd.hpp>
+#include <entt/resource/fwd.hpp>
+
+#include <SFML/System/Time.hpp>
+
+namespace loaders
+{
+	// 异步资源预加载
+	// 图片/音频文件的读取与解码在线程池中执行,主线程只负责纹理上传(需要OpenGL上下文)
+	class Preloader
+	{
+	public:
+		Preloader(const Preloader&) noexcept = delete;
+		Preloader(Preloader&&) noexcept = default;
+		auto operator=(const Preloader&) noexcept -> Preloader& = delete;
+		auto operator=(Preloader&&) noexcept -> Preloader& = default;
+
+		using textures_type = entt::resource_cache<sf::Texture, Texture>;
+		using sounds_type = entt::resource_cache<SoundResource, Sound>;
+
+	private:
+		class Request
+		{
+		public:
+			entt::id_type id;
+			std::filesystem::path path;
+		};
+
+		// 工作线程与主线程共享(任务可能在Preloader销毁后才完成)
+		class State
+		{
+		public:
+			std::mutex mutex;
+
+			// 解码完成,等待上传
+			std::vector<std::pair<entt::id_type, std::unique_ptr<sf::Image>>> images;
+			std::vector<std::pair<entt::id_type, std::unique_ptr<sf::SoundBuffer>>> sound_buffers;
+
+			// 解码失败的数量
+			std::atomic_size_t failed;
+		};
+
+		std::vector<Request> texture_requests_;
+		std::vector<Request> sound_requests_;
+
+		std::shared_ptr<State> state_;
+
+		// 已经上传(或失败)的数量
+		std::size_t finished_;
+		std::size_t total_;
+
+	public:
+		Preloader() noexcept;
+
+		~Preloader() noexcept;
+
+		// 添加纹理(在start之前调用)
+		auto texture(entt::id_type id, std::filesystem::path path) noexcept -> void;
+
+		// 添加音效(在start之前调用)
+		auto sound(entt::id_type id, std::filesystem::path path) noexcept -> void;
+
+		// 开始在线程池中解码所有资源
+		auto start() noexcept -> void;
+
+		// 将已经解码的资源放入缓存(必须在渲染线程调用)
+		// 超出budget后剩余的资源留到下一次调用
+		auto upload(textures_type& textures, sounds_type& sounds, sf::Time budget) noexcept -> void;
+
+		// [0, 1]
+		[[nodiscard]] auto progress() const noexcept -> float;
+
+		[[nodiscard]] auto done() const noexcept -> bool;
+	};
+}
@@ -0,0 +1,172 @@
+#include <loaders/reloader.hpp>
+
+#include <loaders/config.hpp>
+
+#include <logger/logger.hpp>
+
+#include <utility/thread_pool.hpp>
+
+#include <entt/resource/cache.hpp>
+
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace loaders
+{
+	Reloader::Reloader(std::vector<std::filesystem::path> directories) noexcept
+		: directories_{std::move(directories)},
+		  state_{std::make_shared<State>()} {}
+
+	Reloader::~Reloader() noexcept = default;
+
+	auto Reloader::texture(const entt::id_type id, const std::filesystem::path& path) noexcept -> void
+	{
+		sources_[path.lexically_normal()].emplace_back(Kind::TEXTURE, id);
+	}
+
+	auto Reloader::sound(const entt::id_type id, const std::filesystem::path& path) noexcept -> void
+	{
+		sources_[path.lexically_normal()].emplace_back(Kind::SOUND, id);
+	}
+
+	auto Reloader::enable(const bool enable) noexcept -> void
+	{
+		if (enable == enabled())
+		{
+			return;
+		}
+
+		if (enable)
+		{
+			watcher_.emplace(directories_);
+			logger::info("资源热重载: {}", watcher_->native() ? "inotify" : "轮询");
+		}
+		else
+		{
+			watcher_.reset();
+		}
+	}
+
+	auto Reloader::enabled() const noexcept -> bool
+	{
+		return watcher_.has_value();
+	}
+
+	auto Reloader::poll() noexcept -> void
+	{
+		if (not watcher_.has_value())
+		{
+			return;
+		}
+
+		auto& pool = utility::ThreadPool::global();
+
+		for (auto& changed: watcher_->poll())
+		{
+			auto path = changed.lexically_normal();
+
+			if (path.extension() == ".json")
+			{
+				pool.submit(
+					[path = std::move(path)]() noexcept -> void
+					{
+						if (not Config::reload(path))
+						{
+							logger::error("无法重新载入配置: {}", path.string());
+						}
+					}
+				);
+				continue;
+			}
+
+			const auto it = sources_.find(path);
+			if (it == sources_.end())
+			{
+				continue;
+			}
+
+			for (const auto [kind, id]: it->second)
+			{
+				// 直接读取修改后的文件(不使用资源包)
+				if (kind == Kind::TEXTURE)
+				{
+					pool.submit(
+						[state = state_, id, path]() noexcept -> void
+						{
+							auto image = std::make_unique<sf::Image>();
+							if (not image->loadFromFile(path))
+							{
+								logger::error("无法重新载入纹理: {}", path.string());
+								return;
+							}
+
+							std::scoped_lock lock{state->mutex};
+							state->images.emplace_back(id, std::move(image));
+						}
+					);
+				}
+				else
+				{
+					pool.submit(
+						[state = state_, id, path]() noexcept -> void
+						{
+							auto sound_buffer = std::make_unique<sf::SoundBuffer>();
+							if (not sound_buffer->loadFromFile(path))
+							{
+								logger::error("无法重新载入音效: {}", path.string());
+								return;
+							}
+
+							std::scoped_lock lock{state->mutex};
+							state->sound_buffers.emplace_back(id, std::move(sound_buffer));
+						}
+					);
+				}
+			}
+		}
+	}
+
+	auto Reloader::apply(textures_type& textures, sounds_type& sounds) noexcept -> void
+	{
+		decltype(state_->images) images;
+		decltype(state_->sound_buffers) sound_buffers;
+		{
+			std::scoped_lock lock{state_->mutex};
+			std::swap(images, state_->images);
+			std::swap(sound_buffers, state_->sound_buffers);
+		}
+
+		for (const auto& [id, image]: images)
+		{
+			// 不在缓存中(例如已经合并到图集中)
+			auto texture = textures[id];
+			if (not texture)
+			{
+				continue;
+			}
+
+			// 原地替换
+			if (not texture->loadFromImage(*image))
+			{
+				logger::error("无法上传纹理: {}", id);
+				continue;
+			}
+
+			logger::info("重新载入纹理: {}", id);
+		}
+
+		for (auto& [id, sound_buffer]: sound_buffers)
+		{
+			auto sound = sounds[id];
+			if (not sound)
+			{
+				continue;
+			}
+
+			sound->reload(std::move(sound_buffer));
+
+			logger::info("重新载入音效: {}", id);
+		}
+	}
+}
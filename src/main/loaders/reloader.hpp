@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <loaders/texture.hpp>
+#include <loaders/sound.hpp>
+
+#include <utility/file_watcher.hpp>
+
+#include <entt/core/fwd.hpp>
+#include <entt/resource/fwd.hpp>
+
+namespace loaders
+{
+	// 资源热重载
+	// 监视资源目录,文件修改后在线程池中重新解码,之后在帧之间原地替换缓存中的资源
+	// 原地替换保证已经持有的句柄(entt::resource)无需重新获取即可看到新的资源
+	class Reloader
+	{
+	public:
+		Reloader(const Reloader&) noexcept = delete;
+		Reloader(Reloader&&) noexcept = default;
+		auto operator=(const Reloader&) noexcept -> Reloader& = delete;
+		auto operator=(Reloader&&) noexcept -> Reloader& = default;
+
+		using textures_type = entt::resource_cache<sf::Texture, Texture>;
+		using sounds_type = entt::resource_cache<SoundResource, Sound>;
+
+	private:
+		enum class Kind : std::uint8_t
+		{
+			TEXTURE,
+			SOUND,
+		};
+
+		class Source
+		{
+		public:
+			Kind kind;
+			entt::id_type id;
+		};
+
+		// 工作线程与主线程共享(任务可能在Reloader销毁后才完成)
+		class State
+		{
+		public:
+			std::mutex mutex;
+
+			// 解码完成,等待替换
+			std::vector<std::pair<entt::id_type, std::unique_ptr<sf::Image>>> images;
+			std::vector<std::pair<entt::id_type, std::unique_ptr<sf::SoundBuffer>>> sound_buffers;
+		};
+
+		std::vector<std::filesystem::path> directories_;
+		// 启用时才创建
+		std::optional<utility::FileWatcher> watcher_;
+
+		// 文件 => 使用该文件的资源
+		std::unordered_map<std::filesystem::path, std::vector<Source>> sources_;
+
+		std::shared_ptr<State> state_;
+
+	public:
+		explicit Reloader(std::vector<std::filesystem::path> directories) noexcept;
+
+		~Reloader() noexcept;
+
+		// 添加纹理(文件修改后重新载入)
+		auto texture(entt::id_type id, const std::filesystem::path& path) noexcept -> void;
+
+		// 添加音效(文件修改后重新载入)
+		auto sound(entt::id_type id, const std::filesystem::path& path) noexcept -> void;
+
+		auto enable(bool enable) noexcept -> void;
+
+		[[nodiscard]] auto enabled() const noexcept -> bool;
+
+		// 检测修改过的文件并在线程池中重新解码
+		// 配置文件(.json)同样在线程池中重新解析,之后的查询直接使用新的文档
+		auto poll() noexcept -> void;
+
+		// 替换已经重新解码的资源(必须在渲染线程的帧之间调用)
+		auto apply(textures_type& textures, sounds_type& sounds) noexcept -> void;
+	};
+}
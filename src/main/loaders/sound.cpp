@@ -1,75 +1,41 @@
 #include <loaders/sound.hpp>
 
 #include <algorithm>
-#include <ranges>
-#include <random>
 
+#include <loaders/mixer.hpp>
+#include <loaders/pack.hpp>
 #include <loaders/path.hpp>
 
 #include <SFML/Audio.hpp>
 
 namespace loaders
 {
-	auto SoundResource::remove_stopped_sound() const noexcept -> void
-	{
-		const auto ranges = std::ranges::remove_if(
-			playing_sounds_,
-			std::bind_back(std::ranges::equal_to{}, sf::Sound::Status::Stopped),
-			&sf::Sound::getStatus
-		);
-
-		// 重分配
-		// playing_sounds_ =
-		// 		std::move(playing_sounds_) |
-		// 		std::views::filter(
-		// 			[](const auto& sound) noexcept
-		// 			{
-		// 				return sound.getStatus() == sf::Sound::Status::Stopped;
-		// 			}
-		// 		) |
-		// 		std::ranges::to<std::vector>();
-
-		// 不重分配
-		playing_sounds_.erase(ranges.begin(), ranges.end());
-	}
-
-	auto SoundResource::do_play(const bool pitch) const noexcept -> void
-	{
-		remove_stopped_sound();
-
-		if (current_volume_ == min_volume) // NOLINT(clang-diagnostic-float-equal)
-		{
-			return;
-		}
-
-		sf::Sound new_sound{*sound_buffer_};
-		new_sound.setVolume(current_volume_);
-		if (pitch)
-		{
-			static std::mt19937 random{std::random_device{}()};
-			std::uniform_real_distribution<float> distribution{0, 50};
-
-			const auto pitch_value = (75.f + distribution(random)) / 100.f;
-			new_sound.setPitch(pitch_value);
-		}
-
-		auto& sound = playing_sounds_.emplace_back(std::move(new_sound));
-		sound.play();
-	}
-
 	SoundResource::SoundResource(std::unique_ptr<sf::SoundBuffer> sound_buffer) noexcept
 		: sound_buffer_{std::move(sound_buffer)},
 		  current_volume_{max_volume},
-		  saved_volume_{max_volume} {}
+		  saved_volume_{max_volume},
+		  priority_{0},
+		  max_voices_{default_max_voices} {}
+
+	SoundResource::~SoundResource() noexcept
+	{
+		// 声音引用即将销毁的音效数据
+		Mixer::global().stop(*this);
+	}
 
 	auto SoundResource::play() const noexcept -> void
 	{
-		do_play(false);
+		Mixer::global().play(*this, 1.f, false);
 	}
 
 	auto SoundResource::play_pitch_mod() const noexcept -> void
 	{
-		do_play(true);
+		Mixer::global().play(*this, 1.f, true);
+	}
+
+	auto SoundResource::play(const float gain, const bool pitch) const noexcept -> void
+	{
+		Mixer::global().play(*this, gain, pitch);
 	}
 
 	auto SoundResource::set_volume(const float volume) noexcept -> void
@@ -77,10 +43,7 @@ namespace loaders
 		current_volume_ = std::ranges::clamp(volume, min_volume, max_volume);
 		saved_volume_ = current_volume_;
 
-		std::ranges::for_each(
-			playing_sounds_,
-			std::bind_back(&sf::Sound::setVolume, current_volume_)
-		);
+		Mixer::global().set_volume(*this, current_volume_);
 	}
 
 	auto SoundResource::mute() noexcept -> void
@@ -88,20 +51,14 @@ namespace loaders
 		saved_volume_ = current_volume_;
 		current_volume_ = min_volume;
 
-		std::ranges::for_each(
-			playing_sounds_,
-			std::bind_back(&sf::Sound::setVolume, current_volume_)
-		);
+		Mixer::global().set_volume(*this, current_volume_);
 	}
 
 	auto SoundResource::un_mute(const float volume) noexcept -> void
 	{
 		current_volume_ = std::ranges::clamp(volume, min_volume, max_volume);
 
-		std::ranges::for_each(
-			playing_sounds_,
-			std::bind_back(&sf::Sound::setVolume, current_volume_)
-		);
+		Mixer::global().set_volume(*this, current_volume_);
 	}
 
 	auto SoundResource::un_mute() noexcept -> void
@@ -109,10 +66,35 @@ namespace loaders
 		un_mute(saved_volume_);
 	}
 
+	auto SoundResource::set_priority(const std::uint8_t priority) noexcept -> void
+	{
+		priority_ = priority;
+	}
+
+	auto SoundResource::set_max_voices(const std::size_t max_voices) noexcept -> void
+	{
+		max_voices_ = std::ranges::max(max_voices, std::size_t{1});
+	}
+
+	auto SoundResource::reload(std::unique_ptr<sf::SoundBuffer> sound_buffer) noexcept -> void
+	{
+		// 正在播放的声音引用旧的音效数据
+		Mixer::global().stop(*this);
+
+		sound_buffer_ = std::move(sound_buffer);
+	}
+
 	auto Sound::operator()(const std::string_view filename_without_extension) noexcept -> result_type
 	{
 		const auto absolute_path = Path::sound(filename_without_extension);
 
+		// 优先从资源包中载入
+		if (const auto bytes = Pack::find_media(absolute_path); bytes.has_value())
+		{
+			PackStream stream{*bytes};
+			return operator()(stream);
+		}
+
 		if (not exists(absolute_path))
 		{
 			return nullptr;
@@ -153,4 +135,14 @@ namespace loaders
 
 		return std::make_shared<SoundResource>(std::move(sound_buffer));
 	}
+
+	auto Sound::operator()(std::unique_ptr<sf::SoundBuffer> sound_buffer) noexcept -> result_type
+	{
+		if (sound_buffer == nullptr)
+		{
+			return nullptr;
+		}
+
+		return std::make_shared<SoundResource>(std::move(sound_buffer));
+	}
 }
@@ -1,13 +1,12 @@
 #pragma once
 
-#include <vector>
-#include <string>
+#include <cstdint>
 #include <memory>
+#include <string>
 
 namespace sf
 {
 	class SoundBuffer;
-	class Sound;
 
 	class InputStream;
 }
@@ -20,24 +19,38 @@ namespace loaders
 		constexpr static auto min_volume = .0f;
 		constexpr static auto max_volume = 100.f;
 
+		// 同一音效默认最多同时播放的声音数量
+		constexpr static std::size_t default_max_voices = 4;
+
 	private:
-		mutable std::unique_ptr<sf::SoundBuffer> sound_buffer_;
-		mutable std::vector<sf::Sound> playing_sounds_;
+		std::unique_ptr<sf::SoundBuffer> sound_buffer_;
 
 		float current_volume_;
 		float saved_volume_;
 
-		auto remove_stopped_sound() const noexcept -> void;
-
-		auto do_play(bool pitch) const noexcept -> void;
+		// 声音不足时优先级更高的音效可以抢占优先级更低的声音
+		std::uint8_t priority_;
+		// 同时播放的声音数量上限,达到上限后重新开始最早的声音
+		std::size_t max_voices_;
 
 	public:
+		SoundResource(const SoundResource&) noexcept = delete;
+		SoundResource(SoundResource&&) noexcept = delete;
+		auto operator=(const SoundResource&) noexcept -> SoundResource& = delete;
+		auto operator=(SoundResource&&) noexcept -> SoundResource& = delete;
+
 		explicit SoundResource(std::unique_ptr<sf::SoundBuffer> sound_buffer) noexcept;
 
+		~SoundResource() noexcept;
+
+		// 由Mixer在帧末统一播放(同一帧内的多次播放合并为一次)
 		auto play() const noexcept -> void;
 
 		auto play_pitch_mod() const noexcept -> void;
 
+		// gain: 音量倍数(例如由距离衰减/声源合并得到)
+		auto play(float gain, bool pitch) const noexcept -> void;
+
 		auto set_volume(float volume) noexcept -> void;
 
 		auto mute() noexcept -> void;
@@ -45,6 +58,33 @@ namespace loaders
 		auto un_mute(float volume) noexcept -> void;
 
 		auto un_mute() noexcept -> void;
+
+		auto set_priority(std::uint8_t priority) noexcept -> void;
+
+		auto set_max_voices(std::size_t max_voices) noexcept -> void;
+
+		[[nodiscard]] auto buffer() const noexcept -> const sf::SoundBuffer&
+		{
+			return *sound_buffer_;
+		}
+
+		[[nodiscard]] auto volume() const noexcept -> float
+		{
+			return current_volume_;
+		}
+
+		[[nodiscard]] auto priority() const noexcept -> std::uint8_t
+		{
+			return priority_;
+		}
+
+		[[nodiscard]] auto max_voices() const noexcept -> std::size_t
+		{
+			return max_voices_;
+		}
+
+		// 替换音效数据(停止所有正在播放的声音),持有该资源的句柄无需重新获取
+		auto reload(std::unique_ptr<sf::SoundBuffer> sound_buffer) noexcept -> void;
 	};
 
 	class Sound
@@ -58,5 +98,8 @@ namespace loaders
 		[[nodiscard]] static auto operator()(const void* data, std::size_t size) noexcept -> result_type;
 
 		[[nodiscard]] static auto operator()(sf::InputStream& stream) noexcept -> result_type;
+
+		// 已经解码的音效(例如由Preloader在线程池中载入)
+		[[nodiscard]] static auto operator()(std::unique_ptr<sf::SoundBuffer> sound_buffer) noexcept -> result_type;
 	};
 }
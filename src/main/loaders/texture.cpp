@@ -1,35 +1,45 @@
 #include <loaders/texture.hpp>
 
+#include <loaders/pack.hpp>
 #include <loaders/path.hpp>
 
 #include <SFML/Graphics.hpp>
 
 namespace loaders
 {
-	auto Texture::operator()(const TextureType type, const std::string_view filename_without_extension, const bool s_rgb, const sf::IntRect& area) noexcept -> result_type
+	auto Texture::path_of(const TextureType type, const std::string_view filename_without_extension) noexcept -> std::filesystem::path
 	{
-		const auto absolute_path = [&]
+		switch (type)
 		{
-			switch (type)
+			case TextureType::MAP:
+			{
+				return Path::texture_map(filename_without_extension);
+			}
+			case TextureType::ENEMY:
+			{
+				return Path::texture_enemy(filename_without_extension);
+			}
+			case TextureType::TOWER:
+			{
+				return Path::texture_tower(filename_without_extension);
+			}
+			default: // NOLINT(clang-diagnostic-covered-switch-default)
 			{
-				case TextureType::MAP:
-				{
-					return Path::texture_map(filename_without_extension);
-				}
-				case TextureType::ENEMY:
-				{
-					return Path::texture_enemy(filename_without_extension);
-				}
-				case TextureType::TOWER:
-				{
-					return Path::texture_tower(filename_without_extension);
-				}
-				default: // NOLINT(clang-diagnostic-covered-switch-default)
-				{
-					std::unreachable();
-				}
+				std::unreachable();
 			}
-		}();
+		}
+	}
+
+	auto Texture::operator()(const TextureType type, const std::string_view filename_without_extension, const bool s_rgb, const sf::IntRect& area) noexcept -> result_type
+	{
+		const auto absolute_path = path_of(type, filename_without_extension);
+
+		// 优先从资源包中载入
+		if (const auto bytes = Pack::find_media(absolute_path); bytes.has_value())
+		{
+			PackStream stream{*bytes};
+			return operator()(stream, s_rgb, area);
+		}
 
 		if (not exists(absolute_path))
 		{
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include <string>
 
@@ -30,6 +31,9 @@ namespace loaders
 	public:
 		using result_type = std::shared_ptr<sf::Texture>;
 
+		// 纹理文件绝对路径
+		[[nodiscard]] static auto path_of(TextureType type, std::string_view filename_without_extension) noexcept -> std::filesystem::path;
+
 		// TextureType::MAP, map_name ==> media/map/map_name.png
 		// TextureType::ENEMY, enemy_name ==> media/enemy/enemy_name.png
 		// TextureType::TOWER, tower_name ==> media/enemy/tower_name.png
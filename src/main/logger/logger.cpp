@@ -0,0 +1,300 @@
+#include <logger/logger.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using namespace logger;
+
+	// 有界多生产者多消费者队列(Vyukov)
+	// 生产者永不阻塞,队列满时直接返回失败
+	class Queue
+	{
+	public:
+		constexpr static std::size_t capacity = 8192;
+		static_assert(std::has_single_bit(capacity));
+
+	private:
+		class Cell
+		{
+		public:
+			std::atomic<std::size_t> sequence;
+			Record record;
+		};
+
+		std::unique_ptr<Cell[]> cells_;
+
+		alignas(64) std::atomic<std::size_t> enqueue_position_;
+		alignas(64) std::atomic<std::size_t> dequeue_position_;
+
+	public:
+		Queue() noexcept
+			: cells_{std::make_unique<Cell[]>(capacity)},
+			  enqueue_position_{0},
+			  dequeue_position_{0}
+		{
+			for (std::size_t i = 0; i < capacity; ++i)
+			{
+				cells_[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		[[nodiscard]] auto push(const Record& record) noexcept -> bool
+		{
+			auto position = enqueue_position_.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				auto& cell = cells_[position & (capacity - 1)];
+				const auto sequence = cell.sequence.load(std::memory_order_acquire);
+
+				if (const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+					diff == 0)
+				{
+					if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						cell.record = record;
+						cell.sequence.store(position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (diff < 0)
+				{
+					// 队列已满
+					return false;
+				}
+				else
+				{
+					position = enqueue_position_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		[[nodiscard]] auto pop(Record& record) noexcept -> bool
+		{
+			auto position = dequeue_position_.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				auto& cell = cells_[position & (capacity - 1)];
+				const auto sequence = cell.sequence.load(std::memory_order_acquire);
+
+				if (const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+					diff == 0)
+				{
+					if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						record = cell.record;
+						cell.sequence.store(position + capacity, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (diff < 0)
+				{
+					// 队列为空
+					return false;
+				}
+				else
+				{
+					position = dequeue_position_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+	};
+
+	[[nodiscard]] constexpr auto name_of(const Level level) noexcept -> std::string_view
+	{
+		switch (level)
+		{
+			case Level::TRACE: { return "TRACE"; }
+			case Level::DEBUG: { return "DEBUG"; }
+			case Level::INFO: { return "INFO"; }
+			case Level::WARNING: { return "WARNING"; }
+			case Level::ERR: { return "ERROR"; }
+			case Level::OFF: { return "OFF"; }
+		}
+
+		return "UNKNOWN";
+	}
+
+	class State
+	{
+	public:
+		Queue queue;
+
+		std::atomic<Level> level{active_level};
+		std::atomic<std::size_t> dropped{0};
+
+		std::mutex sink_mutex;
+		std::vector<Logger::sink_type> sinks;
+
+		std::ofstream file;
+		bool console{true};
+
+		std::jthread writer;
+	};
+
+	[[nodiscard]] auto state() noexcept -> State&
+	{
+		static State state;
+		return state;
+	}
+
+	auto write_record(State& s, const Record& record, std::string& line, std::string& message) noexcept -> void
+	{
+		message.clear();
+		record.formatter(record, message);
+
+		const auto local_time = std::chrono::zoned_time{std::chrono::current_zone(), std::chrono::floor<std::chrono::seconds>(record.time)};
+
+		line.clear();
+		std::format_to(std::back_inserter(line), "[{:%Y-%m-%d %H:%M:%S}] [{}] {}\n", local_time, name_of(record.level), message);
+
+		if (s.file.is_open())
+		{
+			s.file.write(line.data(), static_cast<std::streamsize>(line.size()));
+		}
+
+		if (s.console)
+		{
+			std::print("{}", line);
+		}
+
+		std::scoped_lock lock{s.sink_mutex};
+		for (const auto& sink: s.sinks)
+		{
+			sink(record.level, message);
+		}
+	}
+
+	// 一次写入队列中的所有日志,返回写入的数量
+	auto drain(State& s, std::string& line, std::string& message) noexcept -> std::size_t
+	{
+		std::size_t count = 0;
+
+		Record record; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		while (s.queue.pop(record))
+		{
+			write_record(s, record, line, message);
+			count += 1;
+		}
+
+		if (count != 0)
+		{
+			if (s.file.is_open())
+			{
+				s.file.flush();
+			}
+
+			if (s.console)
+			{
+				std::fflush(stdout);
+			}
+		}
+
+		return count;
+	}
+}
+
+namespace logger
+{
+	auto Logger::start(const std::filesystem::path& file, const bool console) noexcept -> void
+	{
+		auto& s = state();
+
+		if (s.writer.joinable())
+		{
+			return;
+		}
+
+		if (not file.empty())
+		{
+			if (const auto directory = file.parent_path();
+				not directory.empty())
+			{
+				std::error_code error_code;
+				std::filesystem::create_directories(directory, error_code);
+			}
+
+			s.file.open(file, std::ios::out | std::ios::app);
+		}
+		s.console = console;
+
+		s.writer = std::jthread{
+				[&s](const std::stop_token& stop_token) noexcept -> void
+				{
+					std::string line;
+					std::string message;
+
+					while (not stop_token.stop_requested())
+					{
+						if (drain(s, line, message) == 0)
+						{
+							// 空闲时让出CPU
+							std::this_thread::sleep_for(std::chrono::milliseconds{2});
+						}
+					}
+
+					// 退出前写入所有剩余日志
+					drain(s, line, message);
+				}
+		};
+	}
+
+	auto Logger::stop() noexcept -> void
+	{
+		auto& s = state();
+
+		if (not s.writer.joinable())
+		{
+			return;
+		}
+
+		s.writer.request_stop();
+		s.writer.join();
+
+		if (s.file.is_open())
+		{
+			s.file.close();
+		}
+	}
+
+	auto Logger::set_level(const Level level) noexcept -> void
+	{
+		state().level.store(level, std::memory_order_relaxed);
+	}
+
+	auto Logger::level() noexcept -> Level
+	{
+		return state().level.load(std::memory_order_relaxed);
+	}
+
+	auto Logger::add_sink(sink_type sink) noexcept -> void
+	{
+		auto& s = state();
+
+		std::scoped_lock lock{s.sink_mutex};
+		s.sinks.emplace_back(std::move(sink));
+	}
+
+	auto Logger::push(const Record& record) noexcept -> void
+	{
+		if (auto& s = state();
+			not s.queue.push(record))
+		{
+			s.dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	auto Logger::dropped() noexcept -> std::size_t
+	{
+		return state().dropped.load(std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+// 编译期日志等级,低于该等级的日志调用直接被移除
+// 0: TRACE / 1: DEBUG / 2: INFO / 3: WARNING / 4: ERR / 5: OFF
+#ifndef TD_LOG_ACTIVE_LEVEL
+#define TD_LOG_ACTIVE_LEVEL 0
+#endif
+
+namespace logger
+{
+	enum class Level : std::uint8_t
+	{
+		TRACE = 0,
+		DEBUG = 1,
+		INFO = 2,
+		WARNING = 3,
+		// 不使用ERROR,避免与<wingdi.h>中的ERROR宏冲突
+		ERR = 4,
+		OFF = 5,
+	};
+
+	constexpr auto active_level = static_cast<Level>(TD_LOG_ACTIVE_LEVEL);
+
+	// 预格式化的二进制日志记录
+	// 调用线程只负责将参数按字节写入payload,格式化由后台线程完成
+	class Record
+	{
+	public:
+		using clock_type = std::chrono::system_clock;
+		using format_type = auto (*)(const Record& record, std::string& out) -> void;
+
+		// 参数区大小(字符串超出部分会被截断)
+		constexpr static std::size_t payload_size = 200;
+
+		clock_type::time_point time;
+		format_type formatter;
+		std::string_view format;
+		Level level;
+
+		alignas(8) std::byte payload[payload_size];
+	};
+
+	namespace codec
+	{
+		using string_size_type = std::uint16_t;
+
+		template<typename T>
+		concept string_like = std::is_convertible_v<const T&, std::string_view>;
+
+		template<typename T>
+		concept trivial_like = not string_like<T> and std::is_trivially_copyable_v<T>;
+
+		template<typename T>
+		concept encodable = string_like<T> or trivial_like<T>;
+
+		// 字符串解码为指向payload的string_view,其余类型解码为原类型
+		template<typename T>
+		using decoded_type = std::conditional_t<string_like<T>, std::string_view, T>;
+
+		// 所有定长参数必须能放入payload(每个字符串至少保留长度字段)
+		template<typename... Ts>
+		constexpr auto fixed_size_of = ((string_like<Ts> ? sizeof(string_size_type) : sizeof(Ts)) + ... + 0);
+
+		// 依次写入所有参数
+		// 字符串只能使用之后的参数写入后剩余的空间,保证定长参数不会越界
+		template<encodable T, encodable... Rest>
+		auto encode(std::byte*& it, const std::byte* end, const T& value, const Rest&... rest) noexcept -> void
+		{
+			if constexpr (string_like<T>)
+			{
+				const std::string_view string{value};
+
+				// 长度字段 + 之后所有参数的定长部分
+				constexpr auto reserved = sizeof(string_size_type) + fixed_size_of<Rest...>;
+
+				const auto remaining = static_cast<std::size_t>(end - it);
+				const auto available = remaining > reserved ? remaining - reserved : 0;
+				const auto size = static_cast<string_size_type>(std::ranges::min(string.size(), available));
+
+				std::memcpy(it, &size, sizeof(string_size_type));
+				it += sizeof(string_size_type);
+				std::memcpy(it, string.data(), size);
+				it += size;
+			}
+			else
+			{
+				std::memcpy(it, &value, sizeof(T));
+				it += sizeof(T);
+			}
+
+			if constexpr (sizeof...(Rest) != 0)
+			{
+				encode<Rest...>(it, end, rest...);
+			}
+		}
+
+		template<encodable T>
+		[[nodiscard]] auto decode(const std::byte*& it) noexcept -> decoded_type<T>
+		{
+			if constexpr (string_like<T>)
+			{
+				string_size_type size;
+				std::memcpy(&size, it, sizeof(string_size_type));
+				it += sizeof(string_size_type);
+
+				const std::string_view string{reinterpret_cast<const char*>(it), size};
+				it += size;
+
+				return string;
+			}
+			else
+			{
+				std::array<std::byte, sizeof(T)> bytes;
+				std::memcpy(bytes.data(), it, sizeof(T));
+				it += sizeof(T);
+
+				return std::bit_cast<T>(bytes);
+			}
+		}
+
+		template<typename... Ts>
+		auto format(const Record& record, std::string& out) -> void
+		{
+			const auto* it = record.payload;
+
+			// 花括号初始化保证从左到右求值
+			const std::tuple<decoded_type<Ts>...> values{decode<Ts>(it)...};
+
+			std::apply(
+				[&](const auto&... value) -> void
+				{
+					std::vformat_to(std::back_inserter(out), record.format, std::make_format_args(value...));
+				},
+				values
+			);
+		}
+	}
+
+	class Logger
+	{
+	public:
+		// 后台线程调用,message不包含时间与等级前缀
+		using sink_type = std::function<auto(Level level, std::string_view message) -> void>;
+
+		// 启动后台写入线程
+		// file为空则不写入文件,console为真则同时输出到标准输出
+		static auto start(const std::filesystem::path& file, bool console = true) noexcept -> void;
+
+		// 写入所有剩余日志并停止后台线程
+		static auto stop() noexcept -> void;
+
+		static auto set_level(Level level) noexcept -> void;
+
+		[[nodiscard]] static auto level() noexcept -> Level;
+
+		// 添加额外的输出目标(例如编辑器控制台)
+		static auto add_sink(sink_type sink) noexcept -> void;
+
+		// 写入队列,如果队列已满则丢弃该条日志(绝不阻塞调用线程)
+		static auto push(const Record& record) noexcept -> void;
+
+		// 因队列已满而被丢弃的日志数量
+		[[nodiscard]] static auto dropped() noexcept -> std::size_t;
+	};
+
+	template<Level L, typename... Args>
+	auto write(const std::format_string<Args...> format, Args&&... args) noexcept -> void
+	{
+		if constexpr (L >= active_level and L != Level::OFF)
+		{
+			static_assert((codec::encodable<std::decay_t<Args>> and ...), "Only string-like or trivially copyable arguments can be logged!");
+			static_assert(codec::fixed_size_of<std::decay_t<Args>...> <= Record::payload_size, "Too many arguments!");
+
+			if (L < Logger::level())
+			{
+				return;
+			}
+
+			Record record; // NOLINT(cppcoreguidelines-pro-type-member-init)
+			record.time = Record::clock_type::now();
+			record.formatter = &codec::format<std::decay_t<Args>...>;
+			record.format = format.get();
+			record.level = L;
+
+			if constexpr (sizeof...(Args) != 0)
+			{
+				auto* it = record.payload;
+				const auto* end = record.payload + Record::payload_size;
+				codec::encode<std::decay_t<Args>...>(it, end, args...);
+			}
+
+			Logger::push(record);
+		}
+		else
+		{
+			std::ignore = format;
+			((std::ignore = args), ...);
+		}
+	}
+
+	template<typename... Args>
+	auto trace(const std::format_string<Args...> format, Args&&... args) noexcept -> void
+	{
+		write<Level::TRACE, Args...>(format, std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	auto debug(const std::format_string<Args...> format, Args&&... args) noexcept -> void
+	{
+		write<Level::DEBUG, Args...>(format, std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	auto info(const std::format_string<Args...> format, Args&&... args) noexcept -> void
+	{
+		write<Level::INFO, Args...>(format, std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	auto warning(const std::format_string<Args...> format, Args&&... args) noexcept -> void
+	{
+		write<Level::WARNING, Args...>(format, std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	auto error(const std::format_string<Args...> format, Args&&... args) noexcept -> void
+	{
+		write<Level::ERR, Args...>(format, std::forward<Args>(args)...);
+	}
+}
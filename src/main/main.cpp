@@ -1,4 +1,6 @@
-#include <print>
+// =====================================
+// LOGGER
+#include <logger/logger.hpp>
 
 // =====================================
 // SCENE
@@ -22,6 +24,9 @@
 
 auto main() noexcept -> int
 {
+	// 日志写入后台线程
+	logger::Logger::start("logs/td.log");
+
 	constexpr int window_width = 1920;
 	constexpr int window_height = 1080;
 
@@ -88,4 +93,6 @@ auto main() noexcept -> int
 	}
 
 	ImGui::SFML::Shutdown(window);
+
+	logger::Logger::stop();
 }
@@ -27,7 +27,8 @@ namespace map
 	FlowField::FlowField(const TileMap& map) noexcept
 		: map_{map},
 		  directions_{map.horizontal_tile_count(), map.vertical_tile_count(), Direction::NONE},
-		  costs_{map.horizontal_tile_count(), map.vertical_tile_count(), infinity_cost}
+		  costs_{map.horizontal_tile_count(), map.vertical_tile_count(), infinity_cost},
+		  generation_{0}
 	{
 		//
 	}
@@ -101,6 +102,8 @@ namespace map
 				}
 			}
 		}
+
+		generation_ += 1;
 	}
 
 	auto FlowField::update(const sf::Vector2u point) noexcept -> void
@@ -116,6 +119,11 @@ namespace map
 		build(end_points_);
 	}
 
+	auto FlowField::generation() const noexcept -> std::uint32_t
+	{
+		return generation_;
+	}
+
 	auto FlowField::direction_of(const sf::Vector2u point) const noexcept -> Direction
 	{
 		if (const auto& map = map_.get();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <functional>
 
@@ -25,6 +26,9 @@ namespace map
 		utility::Matrix<Direction> directions_;
 		utility::Matrix<float> costs_;
 
+		// 每次(重新)构建流场后递增,用于判断依赖流场的缓存是否需要更新
+		std::uint32_t generation_;
+
 	public:
 		explicit FlowField(const TileMap& map) noexcept;
 
@@ -32,6 +36,8 @@ namespace map
 
 		auto update(sf::Vector2u point) noexcept -> void;
 
+		[[nodiscard]] auto generation() const noexcept -> std::uint32_t;
+
 		[[nodiscard]] auto direction_of(sf::Vector2u point) const noexcept -> Direction;
 
 		[[nodiscard]] auto cost_of(sf::Vector2u point) const noexcept -> float;
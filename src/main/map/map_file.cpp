@@ -0,0 +1,234 @@
+#include <map/map_file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <utility>
+
+#include <utility/mapped_file.hpp>
+#include <utility/write_file.hpp>
+#include <utility/thread_pool.hpp>
+
+namespace
+{
+	using namespace map;
+
+	static_assert(std::is_trivially_copyable_v<MapFile::Header> and std::is_standard_layout_v<MapFile::Header>);
+	static_assert(std::is_trivially_copyable_v<MapFile::Gate> and std::is_standard_layout_v<MapFile::Gate>);
+
+	// 所有区块按8字节对齐
+	constexpr std::uint64_t block_alignment = 8;
+
+	// 每个任务解码的行数
+	constexpr std::size_t decode_grain = 64;
+
+	[[nodiscard]] constexpr auto align(const std::uint64_t offset) noexcept -> std::uint64_t
+	{
+		return (offset + block_alignment - 1) / block_alignment * block_alignment;
+	}
+
+	// 只有这些值是有效的地块类型
+	[[nodiscard]] constexpr auto valid(const std::uint8_t tile) noexcept -> bool
+	{
+		return tile <= std::to_underlying(TileType::TOWER);
+	}
+
+	// 解码一行地块(低4位是偶数列,高4位是奇数列),返回是否所有地块都有效
+	[[nodiscard]] auto decode_line(const std::span<const std::byte> packed, const std::span<TileType> tiles) noexcept -> bool
+	{
+		std::uint8_t max_tile = 0;
+
+		const auto pairs = tiles.size() / 2;
+		for (std::size_t i = 0; i < pairs; ++i)
+		{
+			const auto byte = std::to_integer<std::uint8_t>(packed[i]);
+			const auto low = static_cast<std::uint8_t>(byte & 0x0f);
+			const auto high = static_cast<std::uint8_t>(byte >> 4);
+
+			tiles[i * 2] = static_cast<TileType>(low);
+			tiles[i * 2 + 1] = static_cast<TileType>(high);
+
+			max_tile = std::ranges::max({max_tile, low, high});
+		}
+
+		if (tiles.size() % 2 != 0)
+		{
+			const auto low = static_cast<std::uint8_t>(std::to_integer<std::uint8_t>(packed[pairs]) & 0x0f);
+
+			tiles.back() = static_cast<TileType>(low);
+
+			max_tile = std::ranges::max(max_tile, low);
+		}
+
+		return valid(max_tile);
+	}
+
+	[[nodiscard]] auto gates_of(const std::span<const MapFile::Gate> gates, const TileMap& tile_map) noexcept -> std::optional<std::vector<sf::Vector2u>>
+	{
+		std::vector<sf::Vector2u> points;
+		points.reserve(gates.size());
+
+		for (const auto [x, y]: gates)
+		{
+			if (not tile_map.inside(x, y))
+			{
+				return std::nullopt;
+			}
+
+			points.emplace_back(x, y);
+		}
+
+		return points;
+	}
+}
+
+namespace map
+{
+	auto MapFile::write(
+		const std::filesystem::path& path,
+		const TileMap& tile_map,
+		const std::span<const sf::Vector2u> start_gates,
+		const std::span<const sf::Vector2u> end_gates
+	) noexcept -> bool
+	{
+		const auto width = tile_map.horizontal_tile_count();
+		const auto height = tile_map.vertical_tile_count();
+		const auto line_size = bytes_per_line(width);
+
+		Header header
+		{
+				.magic = magic,
+				.version = version,
+				.tile_width = tile_map.tile_width(),
+				.tile_height = tile_map.tile_height(),
+				.horizontal_tile_count = width,
+				.vertical_tile_count = height,
+				.start_gate_count = static_cast<std::uint32_t>(start_gates.size()),
+				.end_gate_count = static_cast<std::uint32_t>(end_gates.size()),
+				.tile_offset = 0,
+				.gate_offset = 0,
+		};
+		header.tile_offset = align(sizeof(Header));
+		header.gate_offset = align(header.tile_offset + line_size * height);
+
+		const auto gate_count = start_gates.size() + end_gates.size();
+
+		std::vector<std::byte> bytes(header.gate_offset + gate_count * sizeof(Gate));
+		std::memcpy(bytes.data(), &header, sizeof(Header));
+
+		for (std::uint32_t y = 0; y < height; ++y)
+		{
+			auto* line = bytes.data() + header.tile_offset + y * line_size;
+
+			for (std::uint32_t x = 0; x < width; ++x)
+			{
+				const auto tile = std::to_underlying(tile_map.at(x, y));
+				const auto shift = (x % 2) * 4;
+
+				line[x / 2] |= static_cast<std::byte>(tile << shift);
+			}
+		}
+
+		auto* gate = bytes.data() + header.gate_offset;
+		for (const auto point: start_gates)
+		{
+			const Gate g{.x = point.x, .y = point.y};
+			std::memcpy(gate, &g, sizeof(Gate));
+			gate += sizeof(Gate);
+		}
+		for (const auto point: end_gates)
+		{
+			const Gate g{.x = point.x, .y = point.y};
+			std::memcpy(gate, &g, sizeof(Gate));
+			gate += sizeof(Gate);
+		}
+
+		return utility::write_file(path, bytes);
+	}
+
+	auto MapFile::read(const std::filesystem::path& path) noexcept -> std::optional<Data>
+	{
+		const auto file = utility::MappedFile::open(path);
+		if (not file.has_value())
+		{
+			return std::nullopt;
+		}
+
+		const auto bytes = file->bytes();
+		if (bytes.size() < sizeof(Header))
+		{
+			return std::nullopt;
+		}
+
+		Header header; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		std::memcpy(&header, bytes.data(), sizeof(Header));
+
+		if (header.magic != magic or header.version != version)
+		{
+			return std::nullopt;
+		}
+
+		const auto width = header.horizontal_tile_count;
+		const auto height = header.vertical_tile_count;
+		const auto line_size = bytes_per_line(width);
+		const auto gate_count = static_cast<std::uint64_t>(header.start_gate_count) + header.end_gate_count;
+
+		if (
+			width == 0 or height == 0 or
+			header.tile_offset > bytes.size() or (bytes.size() - header.tile_offset) / line_size < height or
+			header.gate_offset % alignof(Gate) != 0 or
+			header.gate_offset > bytes.size() or (bytes.size() - header.gate_offset) / sizeof(Gate) < gate_count
+		)
+		{
+			return std::nullopt;
+		}
+
+		Data data
+		{
+				.tile_map = {header.tile_width, header.tile_height, width, height},
+				.start_gates = {},
+				.end_gates = {},
+		};
+
+		// 每行独立解码,直接写入TileMap
+		std::atomic_bool tiles_valid{true};
+		utility::ThreadPool::global().parallel_for(
+			height,
+			decode_grain,
+			[&](const std::size_t begin, const std::size_t end) noexcept -> void
+			{
+				auto chunk_valid = true;
+				for (auto y = begin; y < end; ++y)
+				{
+					const auto packed = bytes.subspan(header.tile_offset + y * line_size, line_size);
+					chunk_valid &= decode_line(packed, data.tile_map.line(static_cast<std::uint32_t>(y)));
+				}
+
+				if (not chunk_valid)
+				{
+					tiles_valid.store(false, std::memory_order_relaxed);
+				}
+			}
+		);
+
+		if (not tiles_valid.load(std::memory_order_relaxed))
+		{
+			return std::nullopt;
+		}
+
+		// 文件由write生成,布局与内存布局一致
+		const std::span gates{reinterpret_cast<const Gate*>(bytes.data() + header.gate_offset), gate_count}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+		auto start_gates = gates_of(gates.first(header.start_gate_count), data.tile_map);
+		auto end_gates = gates_of(gates.subspan(header.start_gate_count), data.tile_map);
+		if (not start_gates.has_value() or not end_gates.has_value() or start_gates->empty() or end_gates->empty())
+		{
+			return std::nullopt;
+		}
+
+		data.start_gates = *std::move(start_gates);
+		data.end_gates = *std::move(end_gates);
+
+		return data;
+	}
+}
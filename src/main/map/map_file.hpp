@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <map/tile_map.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace map
+{
+	// 二进制地图文件
+	// [Header][地块(每个地块4位,每行按字节对齐)][起点...][终点...]
+	// 载入时直接映射文件并将地块解码到TileMap中
+	class MapFile
+	{
+	public:
+		// "TDMP"
+		constexpr static std::uint32_t magic = 0x504d'4454;
+		// 文件布局发生变化时递增
+		constexpr static std::uint32_t version = 1;
+
+		class Header
+		{
+		public:
+			std::uint32_t magic;
+			std::uint32_t version;
+
+			std::uint32_t tile_width;
+			std::uint32_t tile_height;
+			std::uint32_t horizontal_tile_count;
+			std::uint32_t vertical_tile_count;
+
+			std::uint32_t start_gate_count;
+			std::uint32_t end_gate_count;
+
+			std::uint64_t tile_offset;
+			std::uint64_t gate_offset;
+		};
+
+		class Gate
+		{
+		public:
+			std::uint32_t x;
+			std::uint32_t y;
+		};
+
+		class Data
+		{
+		public:
+			TileMap tile_map;
+			std::vector<sf::Vector2u> start_gates;
+			std::vector<sf::Vector2u> end_gates;
+		};
+
+		// 每行地块占用的字节数
+		[[nodiscard]] constexpr static auto bytes_per_line(const std::uint32_t horizontal_tile_count) noexcept -> std::size_t
+		{
+			return (static_cast<std::size_t>(horizontal_tile_count) + 1) / 2;
+		}
+
+		// 写入地图文件
+		[[nodiscard]] static auto write(
+			const std::filesystem::path& path,
+			const TileMap& tile_map,
+			std::span<const sf::Vector2u> start_gates,
+			std::span<const sf::Vector2u> end_gates
+		) noexcept -> bool;
+
+		// 读取地图文件,文件无效(或版本不匹配)时返回nullopt
+		[[nodiscard]] static auto read(const std::filesystem::path& path) noexcept -> std::optional<Data>;
+	};
+}
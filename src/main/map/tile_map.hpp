@@ -227,6 +227,17 @@ namespace map
 			data_[x, y] = type;
 		}
 
+		// 第y行的所有地块
+		[[nodiscard]] constexpr auto line(const size_type y) noexcept -> std::span<TileType>
+		{
+			return data_.line(y);
+		}
+
+		[[nodiscard]] constexpr auto line(const size_type y) const noexcept -> std::span<const TileType>
+		{
+			return data_.line(y);
+		}
+
 		[[nodiscard]] constexpr auto begin() noexcept -> iterator
 		{
 			return data_.begin();
@@ -0,0 +1,58 @@
+#include <render/cull.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <components/core/tags.hpp>
+#include <components/core/transform.hpp>
+#include <components/core/renderable.hpp>
+#include <components/core/camera.hpp>
+#include <components/map/map.hpp>
+
+#include <helper/transform.hpp>
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+
+namespace
+{
+	// 网格大小(世界坐标)
+	constexpr auto cell_size = 256.f;
+}
+
+namespace render
+{
+	auto cull(entt::registry& registry, sf::RenderWindow& window) noexcept -> void
+	{
+		using namespace components;
+
+		const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+		auto& [bounds, grid, entities] = registry.ctx().get<camera::Visible>();
+
+		const auto& view = window.getView();
+		bounds = {view.getCenter() - view.getSize() * .5f, view.getSize()};
+
+		const auto renderable_view = registry.view<
+			const transform::Position,
+			const transform::Scale,
+			const renderable::Area,
+			const renderable::Origin>(entt::exclude<tags::invisible>);
+
+		grid.reset(tile_map.map_bounds<float>(), cell_size);
+
+		for (const auto [entity, position, scale, area, origin]: renderable_view.each())
+		{
+			// 任意旋转下精灵到position的最大距离
+			const auto size = sf::Vector2f{area.area.size};
+			const auto far_corner = sf::Vector2f{
+					std::ranges::max(std::abs(origin.origin.x), std::abs(size.x - origin.origin.x)) * std::abs(scale.scale.x),
+					std::ranges::max(std::abs(origin.origin.y), std::abs(size.y - origin.origin.y)) * std::abs(scale.scale.y)
+			};
+
+			grid.insert(entity, helper::Transform::interpolated_position_of(registry, entity, position.position), far_corner.length());
+		}
+
+		entities.clear();
+		grid.query(bounds, entities);
+	}
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+namespace sf
+{
+	class RenderWindow;
+}
+
+namespace render
+{
+	// 更新视图内的可渲染实体(camera::Visible)
+	auto cull(entt::registry& registry, sf::RenderWindow& window) noexcept -> void;
+}
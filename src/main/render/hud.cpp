@@ -22,9 +22,6 @@ namespace render
 
 		auto& [hud_text] = registry.ctx().get<hud::Text>();
 
-		// const auto& view = window.getView();
-		// window.setView(window.getDefaultView());
-
 		const auto window_size = window.getSize();
 
 		// Wave
@@ -197,12 +194,10 @@ namespace render
 
 		// Info
 		{
-			hud_text.setString(L"鼠标左键: 建造塔 | 鼠标右键: 摧毁塔 | 空格键: 暂停/继续 | TAB键: 加速");
+			hud_text.setString(L"鼠标左键: 建造塔 | 鼠标右键: 摧毁塔 | WASD/方向键: 移动视图 | 滚轮: 缩放 | 空格键: 暂停/继续 | TAB键: 加速");
 			hud_text.setPosition({10, static_cast<float>(window_size.y - 30)});
 			hud_text.setFillColor({180, 180, 180});
 			window.draw(hud_text);
 		}
-
-		// window.setView(view);
 	}
 }
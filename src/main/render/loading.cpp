@@ -0,0 +1,36 @@
+#include <render/loading.hpp>
+
+#include <components/game/asset.hpp>
+
+#include <entt/entt.hpp>
+#include <SFML/Graphics.hpp>
+
+namespace render
+{
+	auto loading(entt::registry& registry, sf::RenderWindow& window) noexcept -> void
+	{
+		using namespace components;
+
+		const auto* loading = registry.ctx().find<const asset::Loading>();
+		if (loading == nullptr)
+		{
+			return;
+		}
+
+		const auto window_size = sf::Vector2f{window.getSize()};
+		const auto bar_size = sf::Vector2f{window_size.x * .5f, 24.f};
+		const auto bar_position = (window_size - bar_size) * .5f;
+
+		// 背景
+		sf::RectangleShape background{bar_size};
+		background.setPosition(bar_position);
+		background.setFillColor({60, 60, 60});
+		window.draw(background);
+
+		// 进度
+		sf::RectangleShape progress{{bar_size.x * loading->preloader.progress(), bar_size.y}};
+		progress.setPosition(bar_position);
+		progress.setFillColor({90, 180, 90});
+		window.draw(progress);
+	}
+}
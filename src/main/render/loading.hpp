@@ -0,0 +1,14 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+namespace sf
+{
+	class RenderWindow;
+}
+
+namespace render
+{
+	// 资源加载进度条
+	auto loading(entt::registry& registry, sf::RenderWindow& window) noexcept -> void;
+}
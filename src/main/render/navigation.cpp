@@ -1,81 +1,173 @@
 #include <render/navigation.hpp>
 
+#include <algorithm>
+#include <span>
+
 #include <components/map/map.hpp>
 #include <components/map/navigation.hpp>
 
 #include <entt/entt.hpp>
 #include <SFML/Graphics.hpp>
 
-namespace render
+namespace
 {
-	auto navigation(entt::registry& registry, sf::RenderWindow& window) noexcept -> void
+	// 每个网格流向箭头的顶点数量(3条线段)
+	constexpr std::size_t vertices_per_arrow = 6;
+
+	auto generate_arrow(const map::TileMap& tile_map, const sf::Vector2u point, const map::Direction direction, const std::span<sf::Vertex, vertices_per_arrow> vertices) noexcept -> void
+	{
+		constexpr auto arrow_length = 15.f;
+		constexpr auto arrow_head_length = arrow_length * .35f;
+
+		const auto direction_value = sf::Vector2f{map::value_of(direction)};
+
+		const auto start_position = tile_map.coordinate_grid_to_world(point);
+		const auto end_position = start_position + direction_value * arrow_length;
+		const auto arrow_offset = direction_value * arrow_head_length;
+
+		const auto perpendicular = direction_value.perpendicular();
+		const auto arrow_position_1 = end_position - arrow_offset + perpendicular * arrow_head_length * .5f;
+		const auto arrow_position_2 = end_position - arrow_offset - perpendicular * arrow_head_length * .5f;
+
+		vertices[0] = {.position = start_position, .color = sf::Color::Red, .texCoords = {}};
+		vertices[1] = {.position = end_position, .color = sf::Color::Red, .texCoords = {}};
+		vertices[2] = {.position = arrow_position_1, .color = sf::Color::Red, .texCoords = {}};
+		vertices[3] = {.position = end_position, .color = sf::Color::Red, .texCoords = {}};
+		vertices[4] = {.position = arrow_position_2, .color = sf::Color::Red, .texCoords = {}};
+		vertices[5] = {.position = end_position, .color = sf::Color::Red, .texCoords = {}};
+	}
+
+	// 流场版本变化时更新缓存的顶点
+	auto refresh_overlay(entt::registry& registry) noexcept -> void
 	{
 		using namespace components;
 
 		const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+		const auto& [flow_field] = registry.ctx().get<const navigation::FlowField>();
+		const auto& [cache_paths] = registry.ctx().get<const navigation::Path>();
 
-		// 绘制缓存路径
+		auto& [generation, directions, arrows, paths] = registry.ctx().get<navigation::Overlay>();
+
+		if (generation == flow_field.generation())
+		{
+			return;
+		}
+		generation = flow_field.generation();
+
+		// 网格流向
 		{
-			const auto& [cache_paths] = registry.ctx().get<const navigation::Path>();
+			const auto width = tile_map.horizontal_tile_count();
+			const auto height = tile_map.vertical_tile_count();
+			const auto tile_count = static_cast<std::size_t>(width) * height;
 
-			sf::VertexArray paths{sf::PrimitiveType::LineStrip};
+			// 第一次生成(或者地图大小变化)需要生成所有网格,否则只更新流向变化的网格
+			const auto full = directions.size() != tile_count;
+			if (full)
+			{
+				directions.resize(tile_count);
+				arrows.resize(tile_count * vertices_per_arrow);
+			}
 
-			std::ranges::for_each(
-				cache_paths,
-				[&](const auto& path) noexcept -> void
+			for (std::uint32_t y = 0; y < height; ++y)
+			{
+				for (std::uint32_t x = 0; x < width; ++x)
 				{
-					std::ranges::for_each(
-						path,
-						[&](const auto point) noexcept -> void
-						{
-							const auto world_position = tile_map.coordinate_grid_to_world(point);
-
-							paths.append({.position = world_position, .color = sf::Color::Green, .texCoords = {}});
-						}
-					);
-
-					window.draw(paths);
-					paths.clear();
+					const auto index = static_cast<std::size_t>(y) * width + x;
+					const auto direction = flow_field.direction_of({x, y});
+
+					if (not full and directions[index] == direction)
+					{
+						continue;
+					}
+
+					directions[index] = direction;
+					generate_arrow(tile_map, {x, y}, direction, std::span{arrows}.subspan(index * vertices_per_arrow).first<vertices_per_arrow>());
 				}
-			);
+			}
 		}
 
-		// 绘制网格流向
+		// 缓存路径(数量很少,直接重新生成)
 		{
-			const auto& [flow_field] = registry.ctx().get<const navigation::FlowField>();
+			paths.clear();
 
-			sf::VertexArray directions{sf::PrimitiveType::Lines};
-
-			for (std::uint32_t y = 0; y < tile_map.vertical_tile_count(); ++y)
+			for (const auto& path: cache_paths)
 			{
-				for (std::uint32_t x = 0; x < tile_map.horizontal_tile_count(); ++x)
+				for (std::size_t i = 1; i < path.size(); ++i)
 				{
-					constexpr auto arrow_length = 15.f;
-					constexpr auto arrow_head_length = arrow_length * .35f;
+					paths.push_back({.position = tile_map.coordinate_grid_to_world(path[i - 1]), .color = sf::Color::Green, .texCoords = {}});
+					paths.push_back({.position = tile_map.coordinate_grid_to_world(path[i]), .color = sf::Color::Green, .texCoords = {}});
+				}
+			}
+		}
+	}
+}
 
-					const auto direction = flow_field.direction_of({x, y});
-					const auto direction_value = sf::Vector2f{map::value_of(direction)};
+namespace render
+{
+	auto navigation(entt::registry& registry, sf::RenderWindow& window) noexcept -> void
+	{
+		using namespace components;
 
-					const auto start_position = tile_map.coordinate_grid_to_world(sf::Vector2u{x, y});
-					const auto end_position = start_position + direction_value * arrow_length;
-					const auto arrow_offset = direction_value * arrow_head_length;
+		refresh_overlay(registry);
 
-					directions.append({.position = start_position, .color = sf::Color::Red, .texCoords = {}});
-					directions.append({.position = end_position, .color = sf::Color::Red, .texCoords = {}});
+		const auto& [tile_map] = registry.ctx().get<const map_ex::TileMap>();
+		const auto& [generation, directions, arrows, paths] = registry.ctx().get<const navigation::Overlay>();
 
-					const auto perpendicular = direction_value.perpendicular();
-					const auto arrow_position_1 = end_position - arrow_offset + perpendicular * arrow_head_length * .5f;
-					const auto arrow_position_2 = end_position - arrow_offset - perpendicular * arrow_head_length * .5f;
+		// 绘制缓存路径
+		if (not paths.empty())
+		{
+			window.draw(paths.data(), paths.size(), sf::PrimitiveType::Lines);
+		}
 
-					directions.append({.position = arrow_position_1, .color = sf::Color::Red, .texCoords = {}});
-					directions.append({.position = end_position, .color = sf::Color::Red, .texCoords = {}});
-					directions.append({.position = arrow_position_2, .color = sf::Color::Red, .texCoords = {}});
-					directions.append({.position = end_position, .color = sf::Color::Red, .texCoords = {}});
-				}
+		// 绘制网格流向(只绘制视图内的网格)
+		{
+			const auto& view = window.getView();
+			const auto view_size = view.getSize();
+			const auto view_position = view.getCenter() - view_size * .5f;
+
+			const auto width = tile_map.horizontal_tile_count();
+			const auto height = tile_map.vertical_tile_count();
+			const auto tile_width = static_cast<float>(tile_map.tile_width());
+			const auto tile_height = static_cast<float>(tile_map.tile_height());
+
+			// 箭头可能超出所在网格,向外多取一格
+			const auto to_column = [&](const float value) noexcept -> std::uint32_t
+			{
+				return static_cast<std::uint32_t>(std::ranges::clamp(value / tile_width, 0.f, static_cast<float>(width)));
+			};
+			const auto to_row = [&](const float value) noexcept -> std::uint32_t
+			{
+				return static_cast<std::uint32_t>(std::ranges::clamp(value / tile_height, 0.f, static_cast<float>(height)));
+			};
+
+			const auto first_column = to_column(view_position.x - tile_width);
+			const auto last_column = to_column(view_position.x + view_size.x + tile_width + tile_width);
+			const auto first_row = to_row(view_position.y - tile_height);
+			const auto last_row = to_row(view_position.y + view_size.y + tile_height + tile_height);
+
+			if (first_column >= last_column or first_row >= last_row)
+			{
+				return;
 			}
 
-			window.draw(directions);
-			directions.clear();
+			// 视图覆盖整行时所有可见网格是连续的
+			if (first_column == 0 and last_column == width)
+			{
+				const auto first = static_cast<std::size_t>(first_row) * width * vertices_per_arrow;
+				const auto count = static_cast<std::size_t>(last_row - first_row) * width * vertices_per_arrow;
+
+				window.draw(arrows.data() + first, count, sf::PrimitiveType::Lines);
+				return;
+			}
+
+			// 否则每行可见的网格是连续的
+			for (auto y = first_row; y < last_row; ++y)
+			{
+				const auto first = (static_cast<std::size_t>(y) * width + first_column) * vertices_per_arrow;
+				const auto count = static_cast<std::size_t>(last_column - first_column) * vertices_per_arrow;
+
+				window.draw(arrows.data() + first, count, sf::PrimitiveType::Lines);
+			}
 		}
 	}
 }
@@ -18,8 +18,9 @@ namespace render
 
 			auto& [cursor] = registry.ctx().get<player::Cursor>();
 
-			const auto mouse_position = sf::Mouse::getPosition(window);
-			const auto mouse_grid_position = tile_map.coordinate_world_to_grid(sf::Vector2f{mouse_position});
+			// 窗口坐标 => 世界坐标(使用当前相机视图)
+			const auto mouse_position = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+			const auto mouse_grid_position = tile_map.coordinate_world_to_grid(mouse_position);
 
 			if (tile_map.inside(mouse_grid_position.x, mouse_grid_position.y))
 			{
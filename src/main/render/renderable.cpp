@@ -1,15 +1,17 @@
 #include <render/renderable.hpp>
 
-#include <print>
-
 #include <components/core/tags.hpp>
 #include <components/core/transform.hpp>
 #include <components/core/renderable.hpp>
-#include <components/combat/unit.hpp>
+#include <components/core/camera.hpp>
+
+#include <graphics/atlas.hpp>
+#include <graphics/sprite_batch.hpp>
 
 #include <helper/asset.hpp>
+#include <helper/transform.hpp>
 
-#include <utility/time.hpp>
+#include <logger/logger.hpp>
 
 #include <entt/entt.hpp>
 #include <SFML/Graphics.hpp>
@@ -20,7 +22,10 @@ namespace render
 	{
 		using namespace components;
 
-		static sf::RenderStates states{};
+		auto& [batch] = registry.ctx().get<renderable::Batch>();
+
+		// 只绘制视图内的实体
+		const auto& [bounds, grid, visible_entities] = registry.ctx().get<const camera::Visible>();
 
 		const auto renderable_view = registry.view<
 			const transform::Position,
@@ -31,61 +36,54 @@ namespace render
 			const renderable::Origin,
 			const renderable::Color>(entt::exclude<tags::invisible>);
 
-		for (const auto [entity, position, scale, rotation, texture, area, origin, color]: renderable_view.each())
+		batch.clear();
+		batch.reserve(visible_entities.size());
+		// 存在图集时同一图集页上的所有精灵合并为一个批次
+		batch.set_atlas(registry.ctx().find<const graphics::Atlas>());
+
+		for (const auto entity: visible_entities)
 		{
-			auto render_texture = helper::Asset::texture_of(registry, texture.id);
-			if (not render_texture)
+			if (not renderable_view.contains(entity))
 			{
-				const auto name = [&]
-				{
-					if (const auto* n = registry.try_get<combat::Name>(entity))
-					{
-						return n->name;
-					}
-
-					return std::format("ENTITY {}", entt::to_integral(entity));
-				}();
-
-				std::print(
-					"[{:%Y-%m-%d %H:%M:%S}] [RENDERABLE] 无法渲染位于({:.3f}:{:.3f})的实体[{}],纹理ID: {}",
-					utility::zoned_now(),
-					position.position.x,
-					position.position.y,
-					name,
-					texture.id
-				);
+				continue;
 			}
 
-			auto vertices = [&]
-			{
-				const auto rect = sf::FloatRect{area.area};
-				const auto left = rect.position.x;
-				const auto top = rect.position.y;
-				const auto right = left + rect.size.x;
-				const auto bottom = top + rect.size.y;
+			const auto [position, scale, rotation, texture, area, origin, color] = renderable_view.get(entity);
 
-				std::array<sf::Vertex, 4> vs{};
-				vs[0] = {.position = {0, 0}, .color = color.color, .texCoords = {left, top}};
-				vs[1] = {.position = {rect.size.x, 0}, .color = color.color, .texCoords = {right, top}};
-				vs[2] = {.position = {0, rect.size.y}, .color = color.color, .texCoords = {left, bottom}};
-				vs[3] = {.position = {rect.size.x, rect.size.y}, .color = color.color, .texCoords = {right, bottom}};
+			batch.add(
+				{
+						.texture = texture.id,
+						.position = helper::Transform::interpolated_position_of(registry, entity, position.position),
+						.scale = scale.scale,
+						.rotation = rotation.rotation,
+						.origin = origin.origin,
+						.area = area.area,
+						.color = color.color
+				}
+			);
+		}
 
-				return vs;
-			}();
+		batch.build();
 
-			states.texture = render_texture.operator->();
-			states.transform = [&]
+		// 每个纹理一次draw
+		const auto vertices = batch.vertices();
+		for (const auto& [texture_id, first, count]: batch.batches())
+		{
+			const auto render_texture = helper::Asset::texture_of(registry, texture_id);
+			if (not render_texture)
 			{
-				sf::Transform t{};
-				t.translate(position.position);
-				t.scale(scale.scale);
-				t.rotate(rotation.rotation);
-				t.translate(-origin.origin);
+				logger::error(
+					"[RENDERABLE] 无法渲染{}个实体,纹理ID: {}",
+					count / graphics::SpriteBatch::vertices_per_sprite,
+					texture_id
+				);
+				continue;
+			}
 
-				return t;
-			}();
+			sf::RenderStates states{};
+			states.texture = render_texture.operator->();
 
-			window.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip, states);
+			window.draw(vertices.data() + first, count, sf::PrimitiveType::Triangles, states);
 		}
 	}
 }
@@ -1,39 +1,51 @@
 #include <scene/game.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+
+// ================
+// COMPONENTS
+
+#include <components/core/camera.hpp>
+#include <components/game/game.hpp>
+#include <components/game/asset.hpp>
+
 // ================
 // INITIALIZE
 
 #include <initialize/map_data.hpp>
 #include <initialize/wave_data.hpp>
+#include <initialize/prefab_data.hpp>
 #include <initialize/asset.hpp>
 #include <initialize/event_connection.hpp>
 #include <initialize/game.hpp>
 #include <initialize/map.hpp>
 #include <initialize/navigation.hpp>
 #include <initialize/observer.hpp>
+#include <initialize/weapon.hpp>
 #include <initialize/player.hpp>
 #include <initialize/hud.hpp>
+#include <initialize/renderable.hpp>
+#include <initialize/health_bar.hpp>
+#include <initialize/audio.hpp>
+#include <initialize/camera.hpp>
 
 // ================
 // UPDATE
 
+#include <update/asset.hpp>
 #include <update/game.hpp>
+#include <update/simulation.hpp>
 
-#include <update/wave.hpp>
-#include <update/navigation.hpp>
-#include <update/observer.hpp>
-#include <update/weapon.hpp>
-#include <update/limited_life.hpp>
-#include <update/sprite_frame.hpp>
-
-#include <update/player.hpp>
-#include <update/graveyard.hpp>
-#include <update/resource.hpp>
 #include <update/hud.hpp>
+#include <update/audio.hpp>
 
 // ================
 // RENDER
 
+#include <render/loading.hpp>
+#include <render/cull.hpp>
 #include <render/map.hpp>
 #include <render/navigation.hpp>
 #include <render/renderable.hpp>
@@ -45,12 +57,25 @@
 // HELPER
 
 #include <helper/player.hpp>
+#include <helper/camera.hpp>
+#include <helper/snapshot.hpp>
+#include <helper/replay.hpp>
+
+// ================
+// LOADERS
+
+#include <loaders/path.hpp>
 
 // ================
 // UTILITY
 
 #include <utility/functional.hpp>
 
+// ================
+// LOGGER
+
+#include <logger/logger.hpp>
+
 // ================
 // DEPENDENCIES
 
@@ -58,28 +83,67 @@
 #include <SFML/Window.hpp>
 #include <imgui.h>
 
+namespace
+{
+	using update::simulation_step;
+
+	// 每帧最多追赶的模拟步数
+	constexpr std::uint32_t max_simulation_steps_per_frame = 64;
+	// 每帧模拟耗时预算
+	constexpr auto simulation_budget_per_frame = sf::milliseconds(12);
+
+	// 相机平移速度(像素/秒,按缩放调整)
+	constexpr auto camera_move_speed = 800.f;
+	// 滚轮每格的缩放倍数
+	constexpr auto camera_zoom_step = 1.1f;
+
+	// 自动存档间隔(现实时间)
+	constexpr auto autosave_interval = sf::seconds(60);
+	constexpr std::string_view autosave_name = "autosave";
+	// 快速存档(F5保存/F9载入)
+	constexpr std::string_view quicksave_name = "quicksave";
+	// 本局的输入回放(F6保存,退出时自动保存)
+	constexpr std::string_view replay_name = "last";
+}
+
 namespace scene
 {
-	auto Game::do_update_simulation(const sf::Time delta) noexcept -> void
+	auto Game::do_initialize() noexcept -> void
 	{
-		// 更新游戏状态
-		update::game_simulation(scene_registry_, delta);
-
-		// 更新波次
-		update::wave(scene_registry_, delta);
-		// 更新导航
-		update::navigation(scene_registry_, delta);
-		// 更新观察者
-		update::observer(scene_registry_, delta);
-
-		// 更新塔(武器)目标
-		update::weapon(scene_registry_, delta);
+		// 连接事件
+		initialize::event_connection(scene_registry_);
 
-		// 更新有限生命周期实体
-		update::limited_life(scene_registry_, delta);
+		// 初始化游戏
+		initialize::game(scene_registry_);
+		// 初始化地图
+		initialize::map(scene_registry_);
+		// 初始化导航
+		initialize::navigation(scene_registry_);
+		// 初始化观察者
+		initialize::observer(scene_registry_);
+		// 初始化武器
+		initialize::weapon(scene_registry_);
+		// 初始化玩家
+		initialize::player(scene_registry_);
+		// 初始化HUD
+		initialize::hud(scene_registry_);
+		// 初始化精灵批次
+		initialize::renderable(scene_registry_);
+		// 初始化血条
+		initialize::health_bar(scene_registry_);
+		// 初始化音效
+		initialize::audio(scene_registry_);
+		// 初始化相机
+		initialize::camera(scene_registry_);
+
+		// 录制玩家指令
+		helper::Replay::start(scene_registry_);
+	}
 
-		// 更新精灵帧序列
-		update::sprite_frame(scene_registry_, delta);
+	auto Game::do_update_simulation(const sf::Time delta) noexcept -> void
+	{
+		// 依次执行所有模拟系统(游戏状态/波次/导航/观察者/武器/有限生命周期/精灵帧序列/玩家/墓地/资源)
+		update::simulation(scene_registry_, delta);
 	}
 
 	auto Game::do_update(const sf::Time delta) noexcept -> void
@@ -87,50 +151,79 @@ namespace scene
 		// 更新游戏状态
 		update::game(scene_registry_, delta);
 
-		// 更新玩家(检测到达终点敌人)
-		update::player(scene_registry_);
-		// 更新墓地(击杀敌人产生资源)
-		update::graveyard(scene_registry_);
-		// 更新资源(获取产生的资源)
-		update::resource(scene_registry_);
 		// 更新玩家HUD
 		update::hud(scene_registry_);
+		// 播放本帧的音效
+		update::audio(scene_registry_);
+
+		// 平移相机
+		if (not ImGui::GetIO().WantCaptureKeyboard)
+		{
+			using sf::Keyboard::isKeyPressed;
+			using sf::Keyboard::Key;
+
+			sf::Vector2f direction{};
+			if (isKeyPressed(Key::A) or isKeyPressed(Key::Left))
+			{
+				direction.x -= 1;
+			}
+			if (isKeyPressed(Key::D) or isKeyPressed(Key::Right))
+			{
+				direction.x += 1;
+			}
+			if (isKeyPressed(Key::W) or isKeyPressed(Key::Up))
+			{
+				direction.y -= 1;
+			}
+			if (isKeyPressed(Key::S) or isKeyPressed(Key::Down))
+			{
+				direction.y += 1;
+			}
+
+			if (direction != sf::Vector2f{})
+			{
+				const auto [center, zoom, viewport] = scene_registry_.ctx().get<const components::camera::Camera>();
+
+				helper::Camera::move(scene_registry_, direction.normalized() * camera_move_speed * zoom * delta.asSeconds());
+			}
+		}
 	}
 
 	// todo: 更新全局统计数据等信息?
-	Game::~Game() noexcept = default;
+	Game::~Game() noexcept
+	{
+		if (loaded_ and helper::Replay::save(scene_registry_, loaders::Path::replay(replay_name)))
+		{
+			logger::info("已保存回放: {}", loaders::Path::replay(replay_name).string());
+		}
+	}
 
 	Game::Game(std::shared_ptr<entt::registry> global_registry) noexcept
 		: Scene{std::move(global_registry)},
-		  simulation_times_per_tick_{1}
+		  simulation_speed_{1},
+		  simulation_accumulator_{sf::Time::Zero},
+		  autosave_elapsed_{sf::Time::Zero},
+		  loaded_{false}
 	{
 		// 载入地图数据
 		initialize::map_data(scene_registry_);
 		// 载入波次数据
 		initialize::wave_data(scene_registry_);
+		// 载入预制体数据
+		initialize::prefab_data(scene_registry_);
 
-		// 预加载资源
+		// 预加载资源(在线程池中解码,载入完成后再初始化游戏)
 		initialize::asset(scene_registry_);
-
-		// 连接事件
-		initialize::event_connection(scene_registry_);
-
-		// 初始化游戏
-		initialize::game(scene_registry_);
-		// 初始化地图
-		initialize::map(scene_registry_);
-		// 初始化导航
-		initialize::navigation(scene_registry_);
-		// 初始化观察者
-		initialize::observer(scene_registry_);
-		// 初始化玩家
-		initialize::player(scene_registry_);
-		// 初始化HUD
-		initialize::hud(scene_registry_);
 	}
 
 	auto Game::handle_event(const sf::Event& event) noexcept -> void
 	{
+		// 载入资源时不处理输入
+		if (not loaded_)
+		{
+			return;
+		}
+
 		const auto& io = ImGui::GetIO();
 		const auto want_capture_keyboard = io.WantCaptureKeyboard;
 		const auto want_capture_mouse = io.WantCaptureMouse;
@@ -150,7 +243,8 @@ namespace scene
 							return;
 						}
 
-						const auto position = sf::Vector2f{mbp.position};
+						// 窗口坐标 => 世界坐标
+						const auto position = helper::Camera::pixel_to_world(scene_registry_, mbp.position);
 
 						if (mbp.button == sf::Mouse::Button::Left)
 						{
@@ -161,6 +255,16 @@ namespace scene
 							helper::Player::try_destroy_tower(scene_registry_, position);
 						}
 					},
+					[&](const sf::Event::MouseWheelScrolled& mws) noexcept -> void
+					{
+						if (want_capture_mouse or mws.wheel != sf::Mouse::Wheel::Vertical)
+						{
+							return;
+						}
+
+						// 向上滚动拉近
+						helper::Camera::zoom(scene_registry_, std::pow(camera_zoom_step, -mws.delta), mws.position);
+					},
 					[&](const sf::Event::KeyPressed& kp) noexcept -> void
 					{
 						if (want_capture_keyboard)
@@ -170,11 +274,48 @@ namespace scene
 
 						if (kp.code == sf::Keyboard::Key::Space)
 						{
-							simulation_times_per_tick_ = simulation_times_per_tick_ == 0 ? 1 : 0;
+							simulation_speed_ = simulation_speed_ == 0 ? 1 : 0;
 						}
 						else if (kp.code == sf::Keyboard::Key::Tab)
 						{
-							simulation_times_per_tick_ = 10;
+							simulation_speed_ = 10;
+						}
+						else if (kp.code == sf::Keyboard::Key::F5)
+						{
+							if (helper::Snapshot::save(scene_registry_, loaders::Path::save(quicksave_name)))
+							{
+								logger::info("快速存档完成");
+							}
+							else
+							{
+								logger::warning("快速存档失败");
+							}
+						}
+						else if (kp.code == sf::Keyboard::Key::F6)
+						{
+							if (helper::Replay::save(scene_registry_, loaders::Path::replay(replay_name)))
+							{
+								logger::info("回放保存完成");
+							}
+							else
+							{
+								logger::warning("回放保存失败(载入快照后不再录制)");
+							}
+						}
+						else if (kp.code == sf::Keyboard::Key::F9)
+						{
+							if (helper::Snapshot::load(scene_registry_, loaders::Path::save(quicksave_name)))
+							{
+								// 丢弃载入前累积的时间
+								simulation_accumulator_ = sf::Time::Zero;
+
+								// 回放只能从第一个模拟步开始复现
+								helper::Replay::stop(scene_registry_);
+							}
+							else
+							{
+								logger::warning("载入快速存档失败");
+							}
 						}
 					},
 					[&](const sf::Event::KeyReleased& kr) noexcept -> void
@@ -186,7 +327,7 @@ namespace scene
 
 						if (kr.code == sf::Keyboard::Key::Tab)
 						{
-							simulation_times_per_tick_ = 1;
+							simulation_speed_ = 1;
 						}
 					},
 					// unhandled
@@ -200,16 +341,74 @@ namespace scene
 
 	auto Game::update(const sf::Time delta) noexcept -> void
 	{
-		for (std::uint32_t current_simulation_tick = 0; current_simulation_tick < simulation_times_per_tick_; ++current_simulation_tick)
+		using namespace components;
+
+		// 上传已经解码(或热重载)的资源
+		update::asset(scene_registry_);
+
+		if (not loaded_)
 		{
-			do_update_simulation(delta);
+			if (scene_registry_.ctx().contains<asset::Loading>())
+			{
+				return;
+			}
+
+			do_initialize();
+			loaded_ = true;
 		}
 
+		// 按倍速累积需要模拟的时间
+		simulation_accumulator_ += delta * static_cast<std::int64_t>(simulation_speed_);
+		// 追赶上限,超出的部分直接丢弃(游戏变慢而不是越来越卡)
+		simulation_accumulator_ = std::ranges::min(simulation_accumulator_, simulation_step * static_cast<std::int64_t>(max_simulation_steps_per_frame));
+
+		// 以固定步长模拟,与帧率无关
+		const sf::Clock budget_clock{};
+		while (simulation_accumulator_ >= simulation_step)
+		{
+			do_update_simulation(simulation_step);
+			simulation_accumulator_ -= simulation_step;
+
+			// 超出本帧预算,剩余的时间留给下一帧
+			if (budget_clock.getElapsedTime() >= simulation_budget_per_frame)
+			{
+				break;
+			}
+		}
+
+		// 自动存档(位于两个模拟步之间,延迟的结构性修改都已执行)
+		autosave_elapsed_ += delta;
+		if (autosave_elapsed_ >= autosave_interval)
+		{
+			autosave_elapsed_ = sf::Time::Zero;
+
+			if (not helper::Snapshot::save(scene_registry_, loaders::Path::save(autosave_name)))
+			{
+				logger::warning("自动存档失败");
+			}
+		}
+
+		// 渲染插值系数
+		auto& [alpha] = scene_registry_.ctx().get<game::Interpolation>();
+		alpha = std::ranges::min(simulation_accumulator_ / simulation_step, 1.f);
+
 		do_update(delta);
 	}
 
 	auto Game::render(sf::RenderWindow& window) noexcept -> void
 	{
+		if (not loaded_)
+		{
+			// 资源载入进度
+			render::loading(scene_registry_, window);
+			return;
+		}
+
+		// 地图与实体使用相机视图
+		helper::Camera::apply(scene_registry_, window);
+		// 剔除视图外的实体
+		render::cull(scene_registry_, window);
+
 		// 先渲染地图
 		render::map(scene_registry_, window);
 		// 绘制导航信息(路径/流向)
@@ -220,7 +419,8 @@ namespace scene
 		render::health_bar(scene_registry_, window);
 		// 绘制玩家(鼠标)
 		render::player(scene_registry_, window);
-		// HUD位于最上层
+		// HUD位于最上层(使用默认视图)
+		window.setView(window.getDefaultView());
 		render::hud(scene_registry_, window);
 	}
 }
@@ -13,8 +13,16 @@ namespace scene
 		auto operator=(Game&&) noexcept -> Game& = delete;
 
 	private:
-		std::uint32_t simulation_times_per_tick_;
-
+		// 模拟倍速(0表示暂停)
+		std::uint32_t simulation_speed_;
+		// 累积但还未模拟的时间
+		sf::Time simulation_accumulator_;
+		// 距离上次自动存档的时间
+		sf::Time autosave_elapsed_;
+		// 资源是否已经载入完成(完成后才初始化游戏)
+		bool loaded_;
+
+		auto do_initialize() noexcept -> void;
 		auto do_update_simulation(sf::Time delta) noexcept -> void;
 		auto do_update(sf::Time delta) noexcept -> void;
 
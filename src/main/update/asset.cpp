@@ -0,0 +1,40 @@
+#include <update/asset.hpp>
+
+#include <components/game/asset.hpp>
+
+#include <entt/entt.hpp>
+
+namespace
+{
+	// 每帧上传纹理的时间预算(保持加载界面响应)
+	constexpr auto upload_budget_per_frame = sf::milliseconds(8);
+}
+
+namespace update
+{
+	auto asset(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		auto& [textures] = registry.ctx().get<asset::Textures>();
+		auto& [sounds] = registry.ctx().get<asset::Sounds>();
+
+		if (auto* loading = registry.ctx().find<asset::Loading>();
+			loading != nullptr)
+		{
+			loading->preloader.upload(textures, sounds, upload_budget_per_frame);
+
+			if (loading->preloader.done())
+			{
+				registry.ctx().erase<asset::Loading>();
+			}
+
+			return;
+		}
+
+		// 热重载的资源在帧之间原地替换
+		auto& [reloader] = registry.ctx().get<asset::HotReload>();
+		reloader.poll();
+		reloader.apply(textures, sounds);
+	}
+}
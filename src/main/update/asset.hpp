@@ -0,0 +1,10 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+namespace update
+{
+	// 上传预加载完成的资源,全部完成后移除asset::Loading
+	// 之后替换热重载的资源(在帧之间调用)
+	auto asset(entt::registry& registry) noexcept -> void;
+}
@@ -0,0 +1,92 @@
+#include <update/audio.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <components/core/audio.hpp>
+#include <components/core/camera.hpp>
+
+#include <helper/asset.hpp>
+
+#include <loaders/mixer.hpp>
+#include <loaders/sound.hpp>
+
+#include <logger/logger.hpp>
+
+#include <entt/entt.hpp>
+
+namespace
+{
+	// 听觉半径(视图对角线一半的倍数),超出范围的声源直接剔除
+	constexpr float hearing_scale = 1.5f;
+	// 声源数量每增加一倍增加的音量
+	constexpr float aggregate_gain = .25f;
+	// 合并后音量的上限
+	constexpr float max_gain = 2.f;
+}
+
+namespace update
+{
+	auto audio(entt::registry& registry) noexcept -> void
+	{
+		using namespace components;
+
+		auto& [emissions, missing] = registry.ctx().get<audio::Emissions>();
+		const auto& [bounds, grid, entities] = registry.ctx().get<const camera::Visible>();
+
+		// 视图内的声源音量不衰减,视图外到听觉半径之间线性衰减
+		const auto center = bounds.getCenter();
+		const auto inner = (bounds.size / 2.f).length();
+		const auto outer = inner * hearing_scale;
+
+		// 同一音效的声源放在一起
+		std::ranges::sort(emissions, std::ranges::less{}, &audio::Emission::sound);
+
+		for (auto it = emissions.begin(); it != emissions.end();)
+		{
+			const auto sound_id = it->sound;
+			const auto end = std::ranges::find_if(it, emissions.end(), [sound_id](const audio::Emission& emission) noexcept -> bool { return emission.sound != sound_id; });
+
+			// 听觉范围内的声源数量以及最近的距离
+			std::size_t audible = 0;
+			auto nearest = outer;
+			for (; it != end; ++it)
+			{
+				if (const auto distance = (it->position - center).length();
+					distance <= outer)
+				{
+					audible += 1;
+					nearest = std::ranges::min(nearest, distance);
+				}
+			}
+
+			if (audible == 0 or outer <= 0)
+			{
+				continue;
+			}
+
+			const auto attenuation = nearest <= inner ? 1.f : 1.f - (nearest - inner) / (outer - inner);
+			// 多个声源合并为一个更响的声音
+			const auto gain = std::ranges::min(attenuation * (1.f + aggregate_gain * std::log2(static_cast<float>(audible))), max_gain);
+
+			// 只有视图内的声音使用随机音调
+			const auto sound = helper::Asset::sound_of(registry, sound_id);
+			if (not sound)
+			{
+				if (not std::ranges::contains(missing, sound_id))
+				{
+					logger::warning("音效不存在: {}", sound_id);
+					missing.push_back(sound_id);
+				}
+				continue;
+			}
+
+			sound->play(gain, nearest <= inner);
+		}
+
+		emissions.clear();
+
+		// 同一帧内的多次播放已经合并,此处统一分配声音
+		loaders::Mixer::global().update();
+	}
+}
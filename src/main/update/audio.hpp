@@ -0,0 +1,9 @@
+#pragma once
+
+#include <entt/fwd.hpp>
+
+namespace update
+{
+	// 剔除听觉范围外的声源,合并同一音效的声源并播放(每帧调用一次)
+	auto audio(entt::registry& registry) noexcept -> void;
+}
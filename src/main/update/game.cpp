@@ -1,5 +1,6 @@
 #include <update/game.hpp>
 
+#include <components/core/transform.hpp>
 #include <components/game/game.hpp>
 
 #include <entt/entt.hpp>
@@ -22,7 +23,16 @@ namespace update
 		using namespace components;
 
 		auto& [elapsed] = registry.ctx().get<game::ElapsedSimulationTime>();
+		auto& [tick] = registry.ctx().get<game::SimulationTick>();
 
 		elapsed += delta;
+		tick += 1;
+
+		// 记录本次模拟前的位置用于渲染插值
+		for (const auto view = registry.view<const transform::Position, transform::PreviousPosition>();
+		     const auto [entity, position, previous_position]: view.each())
+		{
+			previous_position.position = position.position;
+		}
 	}
 }
@@ -1,17 +1,23 @@
 #include <update/hud.hpp>
 
 #include <algorithm>
-#include <print>
+#include <bit>
 
 #include <components/combat/unit.hpp>
+#include <components/combat/health_bar.hpp>
+#include <components/game/asset.hpp>
 #include <components/game/wave.hpp>
 #include <components/game/player.hpp>
+#include <components/game/replay.hpp>
 #include <components/map/map.hpp>
 
 #include <factory/enemy.hpp>
 
 #include <helper/wave.hpp>
 #include <helper/resource.hpp>
+#include <helper/replay.hpp>
+
+#include <logger/logger.hpp>
 
 #include <entt/entt.hpp>
 
@@ -42,6 +48,7 @@ namespace update
 
 				if (ImGui::Button("游戏开始"))
 				{
+					helper::Replay::record(registry, replay::CommandType::START_WAVE, 0);
 					helper::Wave::start_from_wave(registry, {.index = 0});
 				}
 
@@ -63,6 +70,7 @@ namespace update
 					if (const auto label = std::format("第 {} 波##spawn", wave_index);
 						ImGui::Button(label.c_str()))
 					{
+						helper::Replay::record(registry, replay::CommandType::SPAWN_WAVE, static_cast<std::uint32_t>(wave_index));
 						helper::Wave::spawn_wave(registry, {.index = static_cast<wave::index_type>(wave_index)});
 					}
 				}
@@ -73,6 +81,7 @@ namespace update
 					if (const auto label = std::format("第 {} 波##start_at", wave_index);
 						ImGui::Button(label.c_str()))
 					{
+						helper::Replay::record(registry, replay::CommandType::START_WAVE, static_cast<std::uint32_t>(wave_index));
 						helper::Wave::start_from_wave(registry, {.index = static_cast<wave::index_type>(wave_index)});
 					}
 				}
@@ -90,7 +99,7 @@ namespace update
 					{
 						selected_enemy_type = enemy_type_base + i;
 
-						std::println("选择敌人: {}", selected_enemy_type);
+						logger::debug("选择敌人: {}", selected_enemy_type);
 					}
 				}
 
@@ -104,12 +113,13 @@ namespace update
 					{
 						if (selected_enemy_type == std::to_underlying(combat::invalid_type))
 						{
-							std::println("未选择敌人类型");
+							logger::debug("未选择敌人类型");
 						}
 						else
 						{
 							const auto type = static_cast<combat::Type>(selected_enemy_type);
 
+							helper::Replay::record(registry, replay::CommandType::SPAWN_ENEMY, selected_enemy_type, {static_cast<std::uint32_t>(i), 0});
 							factory::enemy(registry, static_cast<std::uint32_t>(i), type);
 						}
 					}
@@ -126,10 +136,28 @@ namespace update
 					{
 						player_selected_tower_type = {static_cast<combat::Type>(tower_type_base + i)};
 
-						std::println("选择塔: {}", std::to_underlying(player_selected_tower_type));
+						logger::debug("选择塔: {}", std::to_underlying(player_selected_tower_type));
 					}
 				}
 			}
+			{
+				ImGui::Text("显示");
+				ImGui::Separator();
+
+				auto& [hide_full_health] = registry.ctx().get<health_bar::Options>();
+				ImGui::Checkbox("隐藏满血血条", &hide_full_health);
+			}
+			{
+				ImGui::Text("资源");
+				ImGui::Separator();
+
+				auto& [reloader] = registry.ctx().get<asset::HotReload>();
+				if (bool enabled = reloader.enabled();
+					ImGui::Checkbox("热重载(media/config)", &enabled))
+				{
+					reloader.enable(enabled);
+				}
+			}
 			{
 				ImGui::Text("Show me the money");
 				ImGui::Separator();
@@ -143,27 +171,28 @@ namespace update
 
 				if (ImGui::Button("Acquire"))
 				{
-					if (health != 0)
+					const auto acquire = [&registry](const resource::Type type, const int amount) noexcept -> void
 					{
-						helper::Resource::acquire(
-							registry,
-							resource::Resource{resource::Type::HEALTH, static_cast<resource::size_type>(health)}
-						);
-					}
-					if (mana != 0)
-					{
-						helper::Resource::acquire(
-							registry,
-							resource::Resource{resource::Type::MANA, static_cast<resource::size_type>(mana)}
-						);
-					}
-					if (gold != 0)
-					{
-						helper::Resource::acquire(
+						if (amount == 0)
+						{
+							return;
+						}
+
+						helper::Resource::acquire(registry, resource::Resource{type, static_cast<resource::size_type>(amount)});
+
+						// 资源属于模拟状态,需要录制
+						const auto bits = std::bit_cast<std::uint64_t>(static_cast<resource::size_type>(amount));
+						helper::Replay::record(
 							registry,
-							resource::Resource{resource::Type::GOLD, static_cast<resource::size_type>(gold)}
+							replay::CommandType::ACQUIRE_RESOURCE,
+							std::to_underlying(type),
+							{static_cast<std::uint32_t>(bits), static_cast<std::uint32_t>(bits >> 32)}
 						);
-					}
+					};
+
+					acquire(resource::Type::HEALTH, health);
+					acquire(resource::Type::MANA, mana);
+					acquire(resource::Type::GOLD, gold);
 				}
 			}
 		}
@@ -2,6 +2,7 @@
 
 #include <components/core/transform.hpp>
 #include <components/combat/limited_life.hpp>
+#include <components/game/game.hpp>
 
 #include <helper/combat_unit.hpp>
 
@@ -9,6 +10,21 @@
 
 namespace
 {
+	auto destroy(entt::registry& registry, const entt::entity entity) noexcept -> void
+	{
+		using namespace components;
+
+		// 不能在遍历中销毁,延迟到同步点执行(同时执行死亡回调)
+		auto& [commands] = registry.ctx().get<game::Commands>();
+		commands.destroy(
+			entity,
+			[](entt::registry& reg, const entt::entity e) noexcept -> void
+			{
+				helper::CombatUnit::destroy(reg, e);
+			}
+		);
+	}
+
 	auto update_time(entt::registry& registry, const sf::Time delta) noexcept -> void
 	{
 		using namespace components;
@@ -23,7 +39,7 @@ namespace
 			}
 
 			// todo: 只有combat_unit会用到limited_life吗?
-			helper::CombatUnit::destroy(registry, entity);
+			destroy(registry, entity);
 		}
 	}
 
@@ -43,7 +59,7 @@ namespace
 			}
 
 			// todo: 只有combat_unit会用到limited_life吗?
-			helper::CombatUnit::destroy(registry, entity);
+			destroy(registry, entity);
 		}
 	}
 }
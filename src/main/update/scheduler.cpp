@@ -0,0 +1,178 @@
+#include <update/scheduler.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <latch>
+#include <ranges>
+
+#include <utility/thread_pool.hpp>
+
+namespace
+{
+	[[nodiscard]] auto intersects(const std::vector<entt::id_type>& lhs, const std::vector<entt::id_type>& rhs) noexcept -> bool
+	{
+		return std::ranges::any_of(
+			lhs,
+			[&rhs](const entt::id_type id) noexcept -> bool
+			{
+				return std::ranges::contains(rhs, id);
+			}
+		);
+	}
+
+	[[nodiscard]] auto conflicts(const update::Scheduler::System& lhs, const update::Scheduler::System& rhs) noexcept -> bool
+	{
+		if (lhs.exclusive or rhs.exclusive)
+		{
+			return true;
+		}
+
+		// 写-写 / 写-读 / 读-写
+		return
+				intersects(lhs.writes, rhs.writes) or
+				intersects(lhs.writes, rhs.reads) or
+				intersects(lhs.reads, rhs.writes);
+	}
+
+	auto invoke(
+		const update::Scheduler::System& system,
+		entt::registry& registry,
+		const sf::Time delta,
+		update::Scheduler::duration_type* elapsed
+	) noexcept -> void
+	{
+		if (elapsed == nullptr)
+		{
+			system.update(registry, delta);
+			return;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		system.update(registry, delta);
+		*elapsed += std::chrono::steady_clock::now() - start;
+	}
+}
+
+namespace update
+{
+	auto Scheduler::build() noexcept -> void
+	{
+		// 按照声明顺序构建依赖: 与之前的系统冲突则必须在其之后执行
+		std::vector<std::size_t> stage_of(systems_.size(), 0);
+
+		for (std::size_t i = 0; i < systems_.size(); ++i)
+		{
+			for (std::size_t j = 0; j < i; ++j)
+			{
+				if (conflicts(systems_[j], systems_[i]))
+				{
+					stage_of[i] = std::ranges::max(stage_of[i], stage_of[j] + 1);
+				}
+			}
+		}
+
+		stages_.clear();
+		for (std::size_t i = 0; i < systems_.size(); ++i)
+		{
+			if (stage_of[i] >= stages_.size())
+			{
+				stages_.resize(stage_of[i] + 1);
+			}
+
+			stages_[stage_of[i]].push_back(i);
+		}
+	}
+
+	auto Scheduler::add_exclusive(const std::string_view name, const update_type update) noexcept -> Scheduler&
+	{
+		systems_.emplace_back(
+			name,
+			update,
+			[](entt::registry& registry) noexcept -> void
+			{
+				std::ignore = registry;
+			},
+			std::vector<entt::id_type>{},
+			std::vector<entt::id_type>{},
+			true
+		);
+
+		build();
+		return *this;
+	}
+
+	auto Scheduler::set_sync(const sync_type sync) noexcept -> Scheduler&
+	{
+		sync_ = sync;
+		return *this;
+	}
+
+	auto Scheduler::systems() const noexcept -> std::span<const System>
+	{
+		return systems_;
+	}
+
+	auto Scheduler::stages() const noexcept -> std::span<const stage_type>
+	{
+		return stages_;
+	}
+
+	auto Scheduler::run(entt::registry& registry, const sf::Time delta, const std::span<duration_type> elapsed) const noexcept -> void
+	{
+		assert(elapsed.empty() or elapsed.size() == systems_.size());
+
+		const auto elapsed_of = [&](const std::size_t index) noexcept -> duration_type*
+		{
+			return elapsed.empty() ? nullptr : &elapsed[index];
+		};
+
+		auto& pool = utility::ThreadPool::global();
+
+		for (const auto& stage: stages_)
+		{
+			if (stage.size() == 1)
+			{
+				const auto index = stage.front();
+				invoke(systems_[index], registry, delta, elapsed_of(index));
+
+				if (sync_ != nullptr)
+				{
+					sync_(registry);
+				}
+
+				continue;
+			}
+
+			// 并行访问之前创建所有需要的组件存储
+			for (const auto index: stage)
+			{
+				systems_[index].prepare(registry);
+			}
+
+			std::latch remaining{static_cast<std::ptrdiff_t>(stage.size() - 1)};
+
+			for (const auto index: stage | std::views::drop(1))
+			{
+				pool.submit(
+					[&, index]() noexcept -> void
+					{
+						invoke(systems_[index], registry, delta, elapsed_of(index));
+						remaining.count_down();
+					}
+				);
+			}
+
+			// 调用线程执行第一个系统
+			const auto index = stage.front();
+			invoke(systems_[index], registry, delta, elapsed_of(index));
+
+			remaining.wait();
+
+			// 同步点
+			if (sync_ != nullptr)
+			{
+				sync_(registry);
+			}
+		}
+	}
+}
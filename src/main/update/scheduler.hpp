@@ -0,0 +1,104 @@
+#pragma once
+
+#include <chrono>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+
+#include <SFML/System/Time.hpp>
+
+namespace update
+{
+	// 系统读取的组件(或registry.ctx中的数据)
+	template<typename... Ts>
+	class Read {};
+
+	// 系统修改的组件(或registry.ctx中的数据)
+	template<typename... Ts>
+	class Write {};
+
+	// 根据系统声明的读写集合构建依赖图,互不冲突的系统在线程池中并行执行
+	// 直接创建/销毁实体或添加/移除组件的系统必须声明为独占,独占系统与前后所有系统串行
+	// 非独占系统的结构性修改需要记录到命令缓冲区中,在每个阶段结束后的同步点执行
+	class Scheduler
+	{
+	public:
+		using update_type = auto (*)(entt::registry& registry, sf::Time delta) noexcept -> void;
+		using prepare_type = auto (*)(entt::registry& registry) noexcept -> void;
+		using sync_type = auto (*)(entt::registry& registry) noexcept -> void;
+		using duration_type = std::chrono::nanoseconds;
+
+		class System
+		{
+		public:
+			std::string_view name;
+			update_type update;
+			// 确保系统访问的组件存储已经存在(并行访问时不能创建存储)
+			prepare_type prepare;
+
+			std::vector<entt::id_type> reads;
+			std::vector<entt::id_type> writes;
+
+			bool exclusive;
+		};
+
+		// 同一阶段中的系统可以并行执行
+		using stage_type = std::vector<std::size_t>;
+
+	private:
+		std::vector<System> systems_;
+		std::vector<stage_type> stages_;
+
+		// 每个阶段结束后执行(例如执行延迟的结构性修改)
+		sync_type sync_{nullptr};
+
+		template<typename T>
+		static auto prepare_storage(entt::registry& registry) noexcept -> void
+		{
+			if (not registry.ctx().contains<T>())
+			{
+				std::ignore = registry.storage<T>();
+			}
+		}
+
+		auto build() noexcept -> void;
+
+	public:
+		template<typename... R, typename... W>
+		auto add(const std::string_view name, const update_type update, Read<R...>, Write<W...>) noexcept -> Scheduler&
+		{
+			static_assert(((not std::is_const_v<R>) and ...) and ((not std::is_const_v<W>) and ...));
+
+			systems_.emplace_back(
+				name,
+				update,
+				[](entt::registry& registry) noexcept -> void
+				{
+					(prepare_storage<R>(registry), ...);
+					(prepare_storage<W>(registry), ...);
+				},
+				std::vector<entt::id_type>{entt::type_hash<R>::value()...},
+				std::vector<entt::id_type>{entt::type_hash<W>::value()...},
+				false
+			);
+
+			build();
+			return *this;
+		}
+
+		auto add_exclusive(std::string_view name, update_type update) noexcept -> Scheduler&;
+
+		auto set_sync(sync_type sync) noexcept -> Scheduler&;
+
+		[[nodiscard]] auto systems() const noexcept -> std::span<const System>;
+
+		[[nodiscard]] auto stages() const noexcept -> std::span<const stage_type>;
+
+		// elapsed为空或者与系统数量相同,用于累计每个系统的耗时
+		auto run(entt::registry& registry, sf::Time delta, std::span<duration_type> elapsed = {}) const noexcept -> void;
+	};
+}
@@ -0,0 +1,136 @@
+#include <update/simulation.hpp>
+
+#include <components/core/tags.hpp>
+#include <components/core/transform.hpp>
+#include <components/core/sprite_frame.hpp>
+#include <components/core/renderable.hpp>
+#include <components/combat/enemy.hpp>
+#include <components/combat/limited_life.hpp>
+#include <components/game/game.hpp>
+#include <components/map/map.hpp>
+#include <components/map/navigation.hpp>
+#include <components/map/observer.hpp>
+
+#include <update/game.hpp>
+#include <update/wave.hpp>
+#include <update/navigation.hpp>
+#include <update/observer.hpp>
+#include <update/weapon.hpp>
+#include <update/limited_life.hpp>
+#include <update/sprite_frame.hpp>
+#include <update/player.hpp>
+#include <update/graveyard.hpp>
+#include <update/resource.hpp>
+
+#include <entt/entt.hpp>
+
+namespace update
+{
+	auto simulation_scheduler() noexcept -> const Scheduler&
+	{
+		using namespace components;
+
+		static const auto scheduler = []
+		{
+			Scheduler s{};
+
+			// 更新游戏状态
+			s.add(
+				"game",
+				update::game_simulation,
+				Read<transform::Position>{},
+				Write<game::ElapsedSimulationTime, game::SimulationTick, transform::PreviousPosition>{}
+			);
+			// 更新波次(生成敌人)
+			s.add_exclusive("wave", update::wave);
+			// 更新导航(到达终点的敌人延迟标记)
+			s.add(
+				"navigation",
+				update::navigation,
+				Read<
+					map_ex::TileMap,
+					navigation::FlowField,
+					tags::enemy,
+					tags::archetype_ground,
+					tags::archetype_aerial,
+					tags::dead,
+					enemy::Movement
+				>{},
+				Write<transform::Position, enemy::Direction>{}
+			);
+			// 更新精灵帧序列
+			// 只访问精灵帧/渲染组件,可以与导航并行(观察者读取导航写入的位置,排在导航之后)
+			s.add(
+				"sprite_frame",
+				update::sprite_frame,
+				Read<sprite_frame::Uniform, sprite_frame::Variable>{},
+				Write<sprite_frame::Timer, sprite_frame::Frame, sprite_frame::Condition, renderable::Area, renderable::Origin>{}
+			);
+			// 更新观察者
+			s.add(
+				"observer",
+				update::observer,
+				Read<map_ex::TileMap, transform::Position, tags::archetype_ground, tags::archetype_aerial, tags::dead>{},
+				Write<observer::GroundEnemy, observer::AerialEnemy>{}
+			);
+			// 更新塔(武器)目标
+			s.add_exclusive("weapon", update::weapon);
+			// 更新有限生命周期实体(延迟销毁)
+			s.add(
+				"limited_life",
+				update::limited_life,
+				Read<transform::Position, limited_life::Distance>{},
+				Write<limited_life::Time>{}
+			);
+			// 更新玩家(检测到达终点敌人)
+			// 以下系统会销毁实体,必须在模拟步内执行,否则实体标识的回收顺序与帧率相关(回放无法复现)
+			s.add_exclusive(
+				"player",
+				[](entt::registry& registry, const sf::Time delta) noexcept -> void
+				{
+					std::ignore = delta;
+
+					update::player(registry);
+				}
+			);
+			// 更新墓地(击杀敌人产生资源)
+			s.add_exclusive(
+				"graveyard",
+				[](entt::registry& registry, const sf::Time delta) noexcept -> void
+				{
+					std::ignore = delta;
+
+					update::graveyard(registry);
+				}
+			);
+			// 更新资源(获取产生的资源)
+			s.add_exclusive(
+				"resource",
+				[](entt::registry& registry, const sf::Time delta) noexcept -> void
+				{
+					std::ignore = delta;
+
+					update::resource(registry);
+				}
+			);
+
+			// 每个阶段结束后执行延迟的结构性修改
+			s.set_sync(
+				[](entt::registry& registry) noexcept -> void
+				{
+					auto& [commands] = registry.ctx().get<game::Commands>();
+					commands.flush(registry);
+				}
+			);
+
+			return s;
+		}();
+
+		return scheduler;
+	}
+
+	auto simulation(entt::registry& registry, const sf::Time delta) noexcept -> void
+	{
+		simulation_scheduler().run(registry, delta);
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <update/scheduler.hpp>
+
+#include <entt/fwd.hpp>
+
+#include <SFML/System/Time.hpp>
+
+namespace update
+{
+	// 固定模拟步长(60Hz)
+	constexpr auto simulation_step = sf::microseconds(16'667);
+
+	// 模拟系统调度器
+	// Game与Headless共享,保证两者模拟结果一致
+	[[nodiscard]] auto simulation_scheduler() noexcept -> const Scheduler&;
+
+	// 执行所有模拟系统
+	auto simulation(entt::registry& registry, sf::Time delta) noexcept -> void;
+}
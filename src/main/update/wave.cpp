@@ -1,5 +1,12 @@
 #include <update/wave.hpp>
 
+#include <algorithm>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <components/game/game.hpp>
 #include <components/game/wave.hpp>
 
 #include <factory/enemy.hpp>
@@ -76,16 +83,38 @@ namespace update
 						// todo: 目前没有处理死亡的敌人
 						auto& [wave_enemy] = registry.get<wave::WaveEnemy>(entity);
 
-						std::ranges::for_each(
-							to_spawn,
-							[&](const config::wave::Spawn& spawn) noexcept -> void
+						// 同一出生点的同类型敌人一次批量生成
+						auto pending = to_spawn | std::ranges::to<std::vector<config::wave::Spawn>>();
+						std::ranges::stable_sort(
+							pending,
+							[](const config::wave::Spawn& lhs, const config::wave::Spawn& rhs) noexcept -> bool
 							{
-								const auto enemy = factory::enemy(registry, spawn.gate_id, spawn.type);
-								wave_enemy.push_back(enemy);
+								if (lhs.gate_id != rhs.gate_id)
+								{
+									return lhs.gate_id < rhs.gate_id;
+								}
+
+								return std::to_underlying(lhs.type) < std::to_underlying(rhs.type);
 							}
 						);
 
-						spawn_index.index += static_cast<wave::index_type>(std::ranges::distance(to_spawn));
+						const auto same_group = [](const config::wave::Spawn& lhs, const config::wave::Spawn& rhs) noexcept -> bool
+						{
+							return lhs.gate_id == rhs.gate_id and lhs.type == rhs.type;
+						};
+
+						for (const auto group: pending | std::views::chunk_by(same_group))
+						{
+							const auto& spawn = group.front();
+							const auto count = std::ranges::size(group);
+
+							const auto offset = wave_enemy.size();
+							wave_enemy.resize(offset + count);
+
+							factory::enemy(registry, spawn.gate_id, spawn.type, std::span{wave_enemy}.subspan(offset, count));
+						}
+
+						spawn_index.index += static_cast<wave::index_type>(pending.size());
 					}
 
 					if (spawn_index.index == spawns.size())
@@ -134,8 +163,9 @@ namespace update
 				}
 				case WaveState::DEAD:
 				{
-					// 销毁波次实体
-					registry.destroy(entity);
+					// 销毁波次实体(不能在遍历中销毁)
+					auto& [commands] = registry.ctx().get<game::Commands>();
+					commands.destroy(entity);
 
 					break;
 				}
@@ -1,7 +1,10 @@
 #include <update/weapon.hpp>
 
+#include <algorithm>
+
 #include <components/core/transform.hpp>
 #include <components/combat/weapon.hpp>
+#include <components/game/game.hpp>
 
 #include <helper/observer.hpp>
 
@@ -9,25 +12,42 @@
 
 namespace
 {
-	auto update_cooldown(entt::registry& registry, const sf::Time delta) noexcept -> void
+	auto update_cooldown(entt::registry& registry, const sf::Time now) noexcept -> void
 	{
 		using namespace components;
 
-		const auto delta_time = delta.asSeconds();
+		auto& [cooling, ready] = registry.ctx().get<weapon::Schedule>();
+
+		// 移除已经被销毁的武器
+		std::erase_if(
+			ready,
+			[&](const entt::entity entity) noexcept -> bool
+			{
+				return not registry.valid(entity);
+			}
+		);
 
-		for (const auto tower_view = registry.view<weapon::Cooldown>();
-		     auto [entity, cooldown]: tower_view.each())
+		// 只处理冷却已经结束的武器,冷却中的武器不会被访问
+		while (not cooling.empty())
 		{
-			cooldown.delay -= delta_time;
+			const auto [ready_time, entity] = cooling.top();
 
-			if (cooldown.delay > 0)
+			if (ready_time > now)
 			{
 				// 冷却还没好
+				break;
+			}
+
+			cooling.pop();
+
+			// 武器已经被销毁
+			if (not registry.valid(entity))
+			{
 				continue;
 			}
 
 			// 冷却结束
-			registry.remove<weapon::Cooldown>(entity);
+			ready.push_back(entity);
 		}
 	}
 
@@ -35,10 +55,14 @@ namespace
 	{
 		using namespace components;
 
-		for (const auto tower_view = registry.view<const weapon::Range, const transform::Position>(entt::exclude<weapon::Cooldown>);
-		     const auto [entity, range, position]: tower_view.each())
+		const auto& [cooling, ready] = registry.ctx().get<const weapon::Schedule>();
+
+		for (const auto entity: ready)
 		{
-			if (const auto target = helper::Observer::find_tower_target(registry, entity, position.position, range.range);
+			const auto [range] = registry.get<const weapon::Range>(entity);
+			const auto [position] = registry.get<const transform::Position>(entity);
+
+			if (const auto target = helper::Observer::find_tower_target(registry, entity, position, range);
 				target != entt::null)
 			{
 				// 如果能找到一个目标
@@ -53,19 +77,39 @@ namespace
 		}
 	}
 
-	auto update_fire(entt::registry& registry) noexcept -> void
+	auto update_fire(entt::registry& registry, const sf::Time now) noexcept -> void
 	{
 		using namespace components;
 
-		for (const auto tower_view = registry.view<const weapon::Target, const weapon::FireRate, const weapon::Trigger>(entt::exclude<weapon::Cooldown>);
-		     const auto [entity, target, fire_rate, trigger]: tower_view.each())
+		auto& [cooling, ready] = registry.ctx().get<weapon::Schedule>();
+
+		// 开火的武器进入冷却并离开就绪列表,没有目标的武器继续等待(原地压缩)
+		// 开火可能击杀敌人并移除其他武器的目标,因此逐个检查目标
+		std::size_t waiting = 0;
+		for (std::size_t i = 0; i < ready.size(); ++i)
 		{
+			const auto entity = ready[i];
+
+			const auto* target = registry.try_get<const weapon::Target>(entity);
+			if (target == nullptr)
+			{
+				ready[waiting] = entity;
+				waiting += 1;
+				continue;
+			}
+
+			const auto [fire_rate] = registry.get<const weapon::FireRate>(entity);
+			const auto [on_fire] = registry.get<const weapon::Trigger>(entity);
+
 			// 进入冷却
-			registry.emplace<weapon::Cooldown>(entity, fire_rate.fire_rate);
+			auto& [ready_time] = registry.get<weapon::Cooldown>(entity);
+			ready_time = now + sf::seconds(fire_rate);
+			cooling.emplace(ready_time, entity);
 
 			// 触发攻击
-			trigger.on_fire(registry, entity, target.entity);
+			on_fire(registry, entity, target->entity);
 		}
+		ready.resize(waiting);
 	}
 }
 
@@ -73,10 +117,16 @@ namespace update
 {
 	auto weapon(entt::registry& registry, const sf::Time delta) noexcept -> void
 	{
+		using namespace components;
+
+		std::ignore = delta;
+
+		const auto [now] = registry.ctx().get<const game::ElapsedSimulationTime>();
+
 		// ===================================================
 		// 1. 如果武器处于攻击冷却中,检测是否可以攻击
 
-		update_cooldown(registry, delta);
+		update_cooldown(registry, now);
 
 		// ===================================================
 		// 2. 如果武器处于索敌状态,寻找目标
@@ -86,6 +136,6 @@ namespace update
 		// ===================================================
 		// 3. 如果武器处于攻击状态,进行攻击
 
-		update_fire(registry);
+		update_fire(registry, now);
 	}
 }
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <utility/thread_pool.hpp>
+
+#include <entt/core/type_info.hpp>
+#include <entt/entity/registry.hpp>
+
+namespace utility
+{
+	// 延迟执行的结构性修改(添加/移除组件,销毁实体)
+	// 每个线程写入各自的缓冲区,无需加锁
+	// flush时按照组件存储排序后批量执行,所有销毁最后执行
+	// 排序同时比较实体,执行顺序与修改由哪个线程记录无关(模拟需要可复现)
+	class CommandBuffer
+	{
+	public:
+		using apply_type = auto (*)(entt::registry& registry, entt::entity entity, const std::byte* data) noexcept -> void;
+		using destroy_type = auto (*)(entt::registry& registry, entt::entity entity) noexcept -> void;
+
+		CommandBuffer(const CommandBuffer&) noexcept = delete;
+		CommandBuffer(CommandBuffer&&) noexcept = default;
+		auto operator=(const CommandBuffer&) noexcept -> CommandBuffer& = delete;
+		auto operator=(CommandBuffer&&) noexcept -> CommandBuffer& = default;
+
+	private:
+		class Command
+		{
+		public:
+			entt::id_type storage;
+			apply_type apply;
+			entt::entity entity;
+			// 数据位于arena中的偏移
+			std::size_t offset;
+		};
+
+		class Destroy
+		{
+		public:
+			entt::entity entity;
+			destroy_type destroy;
+		};
+
+		class Arena
+		{
+		public:
+			std::vector<std::byte> data;
+			std::vector<Command> commands;
+			std::vector<Destroy> destroys;
+		};
+
+		// 每个线程一个(ThreadPool::worker_index)
+		std::vector<Arena> arenas_;
+		// 正在执行的修改(与arenas_交换)
+		std::vector<Arena> executing_;
+
+		// flush时使用,避免每次分配
+		std::vector<std::pair<const Command*, const std::byte*>> sorted_;
+		std::vector<const Destroy*> destroying_;
+
+		[[nodiscard]] auto arena() noexcept -> Arena&
+		{
+			const auto index = ThreadPool::worker_index();
+			assert(index < arenas_.size());
+
+			return arenas_[index];
+		}
+
+		template<typename T>
+		static auto do_emplace(entt::registry& registry, const entt::entity entity, const std::byte* data) noexcept -> void
+		{
+			// 实体已经被销毁
+			if (not registry.valid(entity))
+			{
+				return;
+			}
+
+			if constexpr (std::is_empty_v<T>)
+			{
+				std::ignore = data;
+
+				if (not registry.all_of<T>(entity))
+				{
+					registry.emplace<T>(entity);
+				}
+			}
+			else
+			{
+				std::array<std::byte, sizeof(T)> bytes;
+				std::memcpy(bytes.data(), data, sizeof(T));
+
+				registry.emplace_or_replace<T>(entity, std::bit_cast<T>(bytes));
+			}
+		}
+
+		template<typename T>
+		static auto do_remove(entt::registry& registry, const entt::entity entity, const std::byte* data) noexcept -> void
+		{
+			std::ignore = data;
+
+			if (not registry.valid(entity))
+			{
+				return;
+			}
+
+			registry.remove<T>(entity);
+		}
+
+		static auto do_destroy(entt::registry& registry, const entt::entity entity) noexcept -> void
+		{
+			registry.destroy(entity);
+		}
+
+	public:
+		CommandBuffer() noexcept
+			: arenas_(ThreadPool::global().worker_count() + 1),
+			  executing_(arenas_.size()) {}
+
+		~CommandBuffer() noexcept = default;
+
+		// 添加(或替换)组件
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		auto emplace(const entt::entity entity, const T& value = {}) noexcept -> void
+		{
+			auto& [data, commands, destroys] = arena();
+
+			const auto offset = data.size();
+			if constexpr (not std::is_empty_v<T>)
+			{
+				data.resize(offset + sizeof(T));
+				std::memcpy(data.data() + offset, &value, sizeof(T));
+			}
+			else
+			{
+				std::ignore = value;
+			}
+
+			commands.emplace_back(entt::type_hash<T>::value(), &do_emplace<T>, entity, offset);
+		}
+
+		// 移除组件
+		template<typename T>
+		auto remove(const entt::entity entity) noexcept -> void
+		{
+			auto& [data, commands, destroys] = arena();
+
+			commands.emplace_back(entt::type_hash<T>::value(), &do_remove<T>, entity, data.size());
+		}
+
+		// 销毁实体(在所有组件修改之后执行)
+		// destroy可以用于在销毁前执行回调
+		auto destroy(const entt::entity entity, const destroy_type destroy = &do_destroy) noexcept -> void
+		{
+			auto& [data, commands, destroys] = arena();
+
+			destroys.emplace_back(entity, destroy);
+		}
+
+		[[nodiscard]] auto empty() const noexcept -> bool
+		{
+			return std::ranges::all_of(
+				arenas_,
+				[](const Arena& arena) noexcept -> bool
+				{
+					return arena.commands.empty() and arena.destroys.empty();
+				}
+			);
+		}
+
+		// 执行所有记录的修改,只能在没有其他线程写入时调用
+		auto flush(entt::registry& registry) noexcept -> void
+		{
+			// 执行期间(例如销毁回调中)记录的修改在下一轮执行
+			while (not empty())
+			{
+				std::swap(arenas_, executing_);
+
+				sorted_.clear();
+				for (const auto& arena: executing_)
+				{
+					for (const auto& command: arena.commands)
+					{
+						sorted_.emplace_back(&command, arena.data.data());
+					}
+				}
+
+				// 同一组件存储的修改放在一起执行,同一实体的修改保持记录顺序
+				std::ranges::stable_sort(
+					sorted_,
+					std::ranges::less{},
+					[](const std::pair<const Command*, const std::byte*>& pair) noexcept -> std::pair<entt::id_type, entt::id_type>
+					{
+						return {pair.first->storage, entt::to_integral(pair.first->entity)};
+					}
+				);
+
+				for (const auto [command, data]: sorted_)
+				{
+					command->apply(registry, command->entity, data + command->offset);
+				}
+
+				// 销毁顺序决定了实体标识的回收顺序
+				destroying_.clear();
+				for (const auto& arena: executing_)
+				{
+					for (const auto& destroy: arena.destroys)
+					{
+						destroying_.emplace_back(&destroy);
+					}
+				}
+
+				std::ranges::stable_sort(
+					destroying_,
+					std::ranges::less{},
+					[](const Destroy* destroy) noexcept -> entt::id_type
+					{
+						return entt::to_integral(destroy->entity);
+					}
+				);
+
+				for (const auto* destroying: destroying_)
+				{
+					const auto [entity, destroy] = *destroying;
+
+					// 可能被记录多次
+					if (registry.valid(entity))
+					{
+						destroy(registry, entity);
+					}
+				}
+
+				for (auto& [data, commands, destroys]: executing_)
+				{
+					data.clear();
+					commands.clear();
+					destroys.clear();
+				}
+			}
+		}
+	};
+}
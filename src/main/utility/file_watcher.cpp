@@ -0,0 +1,211 @@
+#include <utility/file_watcher.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+#if defined(__linux__)
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#endif
+
+namespace utility
+{
+	auto FileWatcher::watch(const std::filesystem::path& directory) noexcept -> void
+	{
+		#if defined(__linux__)
+		const auto add = [this](const std::filesystem::path& path) noexcept -> void
+		{
+			// 文件写入完成/移动到目录中/创建子目录
+			if (const auto wd = inotify_add_watch(descriptor_, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+				wd >= 0)
+			{
+				watches_[wd] = path;
+			}
+		};
+
+		add(directory);
+
+		std::error_code error_code;
+		for (auto it = std::filesystem::recursive_directory_iterator{directory, error_code}; not error_code and it != std::filesystem::recursive_directory_iterator{}; it.increment(error_code))
+		{
+			if (it->is_directory(error_code))
+			{
+				add(it->path());
+			}
+		}
+		#else
+		std::ignore = directory;
+		#endif
+	}
+
+	auto FileWatcher::scan(std::vector<std::filesystem::path>& changed) noexcept -> void
+	{
+		// 第一次扫描只记录修改时间
+		const auto first = write_times_.empty();
+
+		std::error_code error_code;
+		for (const auto& directory: directories_)
+		{
+			for (auto it = std::filesystem::recursive_directory_iterator{directory, error_code}; not error_code and it != std::filesystem::recursive_directory_iterator{}; it.increment(error_code))
+			{
+				if (not it->is_regular_file(error_code))
+				{
+					continue;
+				}
+
+				const auto write_time = it->last_write_time(error_code);
+				if (error_code)
+				{
+					continue;
+				}
+
+				if (auto [entry, inserted] = write_times_.try_emplace(it->path(), write_time);
+					inserted)
+				{
+					if (not first)
+					{
+						changed.push_back(it->path());
+					}
+				}
+				else if (entry->second != write_time)
+				{
+					entry->second = write_time;
+					changed.push_back(it->path());
+				}
+			}
+		}
+	}
+
+	auto FileWatcher::close() noexcept -> void
+	{
+		#if defined(__linux__)
+		if (descriptor_ >= 0)
+		{
+			::close(descriptor_);
+		}
+		#endif
+
+		descriptor_ = -1;
+		watches_.clear();
+	}
+
+	FileWatcher::FileWatcher(std::vector<std::filesystem::path> directories) noexcept
+		: directories_{std::move(directories)},
+		  descriptor_{-1},
+		  next_scan_{clock_type::now()}
+	{
+		#if defined(__linux__)
+		descriptor_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (descriptor_ >= 0)
+		{
+			for (const auto& directory: directories_)
+			{
+				watch(directory);
+			}
+
+			return;
+		}
+		#endif
+
+		// 记录当前的修改时间
+		std::vector<std::filesystem::path> changed;
+		scan(changed);
+		next_scan_ = clock_type::now() + poll_interval;
+	}
+
+	FileWatcher::FileWatcher(FileWatcher&& other) noexcept
+		: directories_{std::move(other.directories_)},
+		  descriptor_{std::exchange(other.descriptor_, -1)},
+		  watches_{std::move(other.watches_)},
+		  write_times_{std::move(other.write_times_)},
+		  next_scan_{other.next_scan_} {}
+
+	auto FileWatcher::operator=(FileWatcher&& other) noexcept -> FileWatcher&
+	{
+		if (this != &other)
+		{
+			close();
+
+			directories_ = std::move(other.directories_);
+			descriptor_ = std::exchange(other.descriptor_, -1);
+			watches_ = std::move(other.watches_);
+			write_times_ = std::move(other.write_times_);
+			next_scan_ = other.next_scan_;
+		}
+
+		return *this;
+	}
+
+	FileWatcher::~FileWatcher() noexcept
+	{
+		close();
+	}
+
+	auto FileWatcher::poll() noexcept -> std::vector<std::filesystem::path>
+	{
+		std::vector<std::filesystem::path> changed;
+
+		if (not native())
+		{
+			if (const auto now = clock_type::now();
+				now >= next_scan_)
+			{
+				scan(changed);
+				next_scan_ = now + poll_interval;
+			}
+
+			return changed;
+		}
+
+		#if defined(__linux__)
+		alignas(inotify_event) std::array<char, 4096> buffer; // NOLINT(cppcoreguidelines-pro-type-member-init)
+		while (true)
+		{
+			const auto length = ::read(descriptor_, buffer.data(), buffer.size());
+			if (length <= 0)
+			{
+				// 没有更多事件
+				break;
+			}
+
+			for (std::size_t offset = 0; offset < static_cast<std::size_t>(length);)
+			{
+				inotify_event event; // NOLINT(cppcoreguidelines-pro-type-member-init)
+				std::memcpy(&event, buffer.data() + offset, sizeof(inotify_event));
+
+				if (event.len != 0)
+				{
+					if (const auto it = watches_.find(event.wd);
+						it != watches_.end())
+					{
+						const auto path = it->second / std::string_view{buffer.data() + offset + sizeof(inotify_event)}; // NOLINT(bugprone-suspicious-stringview-data-usage)
+
+						if ((event.mask & IN_ISDIR) != 0)
+						{
+							// 新建的子目录
+							watch(path);
+						}
+						else if ((event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) != 0)
+						{
+							changed.push_back(path);
+						}
+					}
+				}
+
+				offset += sizeof(inotify_event) + event.len;
+			}
+		}
+
+		// 同一文件可能产生多个事件
+		std::ranges::sort(changed);
+		const auto [first, last] = std::ranges::unique(changed);
+		changed.erase(first, last);
+		#endif
+
+		return changed;
+	}
+}
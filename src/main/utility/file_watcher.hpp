@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+namespace utility
+{
+	// 监视目录(包括子目录)中被修改的文件
+	// Linux上使用inotify,其他平台(或inotify不可用时)定期比较文件修改时间
+	class FileWatcher
+	{
+	public:
+		using clock_type = std::chrono::steady_clock;
+
+		// 轮询的间隔
+		constexpr static auto poll_interval = std::chrono::seconds{1};
+
+		FileWatcher(const FileWatcher&) noexcept = delete;
+		auto operator=(const FileWatcher&) noexcept -> FileWatcher& = delete;
+
+	private:
+		std::vector<std::filesystem::path> directories_;
+
+		// inotify描述符(-1表示使用轮询)
+		int descriptor_;
+		// watch描述符 => 目录
+		std::unordered_map<int, std::filesystem::path> watches_;
+
+		// 文件 => 修改时间(轮询时使用)
+		std::unordered_map<std::filesystem::path, std::filesystem::file_time_type> write_times_;
+		clock_type::time_point next_scan_;
+
+		// 监视目录及其所有子目录
+		auto watch(const std::filesystem::path& directory) noexcept -> void;
+
+		// 比较所有文件的修改时间
+		auto scan(std::vector<std::filesystem::path>& changed) noexcept -> void;
+
+		auto close() noexcept -> void;
+
+	public:
+		explicit FileWatcher(std::vector<std::filesystem::path> directories) noexcept;
+
+		FileWatcher(FileWatcher&& other) noexcept;
+		auto operator=(FileWatcher&& other) noexcept -> FileWatcher&;
+
+		~FileWatcher() noexcept;
+
+		// 是否使用inotify
+		[[nodiscard]] auto native() const noexcept -> bool
+		{
+			return descriptor_ >= 0;
+		}
+
+		// 返回自上次调用以来被修改(或新建)的文件,不会阻塞
+		[[nodiscard]] auto poll() noexcept -> std::vector<std::filesystem::path>;
+	};
+}
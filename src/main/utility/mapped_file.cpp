@@ -0,0 +1,157 @@
+#include <utility/mapped_file.hpp>
+
+#include <utility>
+
+#if defined(_WIN32)
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+namespace utility
+{
+	MappedFile::MappedFile(const std::byte* data, const std::size_t size, void* file, void* mapping) noexcept
+		: data_{data},
+		  size_{size},
+		  file_{file},
+		  mapping_{mapping} {}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: data_{std::exchange(other.data_, nullptr)},
+		  size_{std::exchange(other.size_, 0)},
+		  file_{std::exchange(other.file_, nullptr)},
+		  mapping_{std::exchange(other.mapping_, nullptr)} {}
+
+	auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile&
+	{
+		if (this != &other)
+		{
+			close();
+
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+			file_ = std::exchange(other.file_, nullptr);
+			mapping_ = std::exchange(other.mapping_, nullptr);
+		}
+
+		return *this;
+	}
+
+	MappedFile::~MappedFile() noexcept
+	{
+		close();
+	}
+
+#if defined(_WIN32)
+
+	auto MappedFile::open(const std::filesystem::path& path) noexcept -> std::optional<MappedFile>
+	{
+		auto* file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return std::nullopt;
+		}
+
+		LARGE_INTEGER size;
+		if (not GetFileSizeEx(file, &size) or size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return std::nullopt;
+		}
+
+		auto* mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr)
+		{
+			CloseHandle(file);
+			return std::nullopt;
+		}
+
+		const auto* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (data == nullptr)
+		{
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return std::nullopt;
+		}
+
+		return MappedFile{static_cast<const std::byte*>(data), static_cast<std::size_t>(size.QuadPart), file, mapping};
+	}
+
+	auto MappedFile::close() noexcept -> void
+	{
+		if (data_ != nullptr)
+		{
+			UnmapViewOfFile(data_);
+			data_ = nullptr;
+		}
+
+		if (mapping_ != nullptr)
+		{
+			CloseHandle(mapping_);
+			mapping_ = nullptr;
+		}
+
+		if (file_ != nullptr)
+		{
+			CloseHandle(file_);
+			file_ = nullptr;
+		}
+
+		size_ = 0;
+	}
+
+#else
+
+	auto MappedFile::open(const std::filesystem::path& path) noexcept -> std::optional<MappedFile>
+	{
+		const auto fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			return std::nullopt;
+		}
+
+		struct stat status{};
+		if (fstat(fd, &status) != 0 or status.st_size == 0)
+		{
+			::close(fd);
+			return std::nullopt;
+		}
+
+		const auto size = static_cast<std::size_t>(status.st_size);
+		auto* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		// 映射建立后即可关闭文件
+		::close(fd);
+
+		if (data == MAP_FAILED)
+		{
+			return std::nullopt;
+		}
+
+		return MappedFile{static_cast<const std::byte*>(data), size, nullptr, nullptr};
+	}
+
+	auto MappedFile::close() noexcept -> void
+	{
+		if (data_ != nullptr)
+		{
+			munmap(const_cast<std::byte*>(data_), size_);
+			data_ = nullptr;
+		}
+
+		file_ = nullptr;
+		mapping_ = nullptr;
+		size_ = 0;
+	}
+
+#endif
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace utility
+{
+	// 只读内存映射文件
+	class MappedFile
+	{
+	public:
+		MappedFile(const MappedFile&) noexcept = delete;
+		auto operator=(const MappedFile&) noexcept -> MappedFile& = delete;
+
+	private:
+		const std::byte* data_;
+		std::size_t size_;
+
+		// 平台相关的句柄
+		void* file_;
+		void* mapping_;
+
+		MappedFile(const std::byte* data, std::size_t size, void* file, void* mapping) noexcept;
+
+		auto close() noexcept -> void;
+
+	public:
+		MappedFile(MappedFile&& other) noexcept;
+		auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+		~MappedFile() noexcept;
+
+		// 映射整个文件,文件不存在或为空时返回nullopt
+		[[nodiscard]] static auto open(const std::filesystem::path& path) noexcept -> std::optional<MappedFile>;
+
+		[[nodiscard]] auto data() const noexcept -> const std::byte*
+		{
+			return data_;
+		}
+
+		[[nodiscard]] auto size() const noexcept -> std::size_t
+		{
+			return size_;
+		}
+
+		[[nodiscard]] auto bytes() const noexcept -> std::span<const std::byte>
+		{
+			return {data_, size_};
+		}
+	};
+}
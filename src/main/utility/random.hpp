@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+namespace utility
+{
+	// 基于计数器的随机数(SplitMix64)
+	// 随机数只由(seed, stream, counter)决定,不共享任何状态,可以在任意线程使用
+	// 相同的种子与流总是得到相同的随机数序列(用于回放/无界面模拟)
+	class Random
+	{
+	public:
+		using seed_type = std::uint64_t;
+		using value_type = std::uint64_t;
+
+	private:
+		constexpr static value_type golden_gamma = 0x9e37'79b9'7f4a'7c15;
+
+		value_type key_;
+		value_type counter_;
+
+	public:
+		// SplitMix64的输出函数
+		[[nodiscard]] constexpr static auto mix(value_type value) noexcept -> value_type
+		{
+			value = (value ^ (value >> 30)) * 0xbf58'476d'1ce4'e5b9;
+			value = (value ^ (value >> 27)) * 0x94d0'49bb'1331'11eb;
+			return value ^ (value >> 31);
+		}
+
+		// seed: 每局游戏的种子
+		// stream: 随机数流(例如生成索引),不同的流互不相关
+		constexpr Random(const seed_type seed, const value_type stream) noexcept
+			: key_{mix(seed + mix(stream + golden_gamma))},
+			  counter_{0} {}
+
+		// 第counter个随机数(不改变状态)
+		[[nodiscard]] constexpr auto at(const value_type counter) const noexcept -> value_type
+		{
+			return mix(key_ + (counter + 1) * golden_gamma);
+		}
+
+		[[nodiscard]] constexpr auto next() noexcept -> value_type
+		{
+			return at(counter_++);
+		}
+
+		// [0, 1)
+		[[nodiscard]] constexpr auto unit() noexcept -> float
+		{
+			// 取高24位作为尾数
+			return static_cast<float>(next() >> 40) * 0x1.0p-24f;
+		}
+
+		// [min, max)
+		[[nodiscard]] constexpr auto real(const float min, const float max) noexcept -> float
+		{
+			return min + (max - min) * unit();
+		}
+
+		// [min, max]
+		[[nodiscard]] constexpr auto integer(const std::uint32_t min, const std::uint32_t max) noexcept -> std::uint32_t
+		{
+			const auto range = static_cast<std::uint64_t>(max - min) + 1;
+			// 取高32位乘以范围(Lemire),忽略极小的偏差
+			return min + static_cast<std::uint32_t>(((next() >> 32) * range) >> 32);
+		}
+	};
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utility
+{
+	class ThreadPool
+	{
+	public:
+		using task_type = std::function<auto() -> void>;
+
+		ThreadPool(const ThreadPool&) noexcept = delete;
+		ThreadPool(ThreadPool&&) noexcept = delete;
+		auto operator=(const ThreadPool&) noexcept -> ThreadPool& = delete;
+		auto operator=(ThreadPool&&) noexcept -> ThreadPool& = delete;
+
+	private:
+		// 0表示非工作线程(例如主线程),工作线程为[1, worker_count]
+		inline static thread_local std::size_t worker_index_ = 0;
+
+		std::mutex mutex_;
+		std::condition_variable_any condition_;
+		std::deque<task_type> tasks_;
+
+		std::vector<std::jthread> workers_;
+
+		auto work(const std::stop_token& stop_token, const std::size_t index) noexcept -> void
+		{
+			worker_index_ = index;
+
+			while (true)
+			{
+				task_type task;
+				{
+					std::unique_lock lock{mutex_};
+
+					if (not condition_.wait(lock, stop_token, [this] { return not tasks_.empty(); }))
+					{
+						// 请求停止且没有剩余任务
+						return;
+					}
+
+					task = std::move(tasks_.front());
+					tasks_.pop_front();
+				}
+
+				task();
+			}
+		}
+
+	public:
+		explicit ThreadPool(const std::size_t worker_count) noexcept
+		{
+			workers_.reserve(worker_count);
+			for (std::size_t i = 0; i < worker_count; ++i)
+			{
+				workers_.emplace_back(
+					[this, index = i + 1](const std::stop_token& stop_token) noexcept -> void
+					{
+						work(stop_token, index);
+					}
+				);
+			}
+		}
+
+		~ThreadPool() noexcept
+		{
+			for (auto& worker: workers_)
+			{
+				worker.request_stop();
+			}
+			condition_.notify_all();
+		}
+
+		// 全局线程池(保留一个硬件线程给主线程)
+		[[nodiscard]] static auto global() noexcept -> ThreadPool&
+		{
+			static ThreadPool pool{std::ranges::max(std::thread::hardware_concurrency(), 2u) - 1};
+			return pool;
+		}
+
+		// 当前线程的索引(0表示非工作线程)
+		// 可以用于索引大小为(worker_count() + 1)的线程局部数据
+		[[nodiscard]] static auto worker_index() noexcept -> std::size_t
+		{
+			return worker_index_;
+		}
+
+		[[nodiscard]] auto worker_count() const noexcept -> std::size_t
+		{
+			return workers_.size();
+		}
+
+		auto submit(task_type task) noexcept -> void
+		{
+			{
+				std::scoped_lock lock{mutex_};
+				tasks_.emplace_back(std::move(task));
+			}
+			condition_.notify_one();
+		}
+
+		// 将[0, count)按grain大小分块并行执行function(begin, end),调用线程同样参与执行
+		// 阻塞直到所有分块完成
+		template<typename Function>
+		auto parallel_for(const std::size_t count, const std::size_t grain, Function&& function) noexcept -> void
+		{
+			if (count == 0)
+			{
+				return;
+			}
+
+			const auto chunk_size = std::ranges::max(grain, std::size_t{1});
+			const auto chunk_count = (count + chunk_size - 1) / chunk_size;
+
+			if (chunk_count == 1 or workers_.empty())
+			{
+				function(std::size_t{0}, count);
+				return;
+			}
+
+			std::latch remaining{static_cast<std::ptrdiff_t>(chunk_count - 1)};
+
+			for (std::size_t chunk = 1; chunk < chunk_count; ++chunk)
+			{
+				const auto begin = chunk * chunk_size;
+				const auto end = std::ranges::min(begin + chunk_size, count);
+
+				submit(
+					[&function, &remaining, begin, end]() noexcept -> void
+					{
+						function(begin, end);
+						remaining.count_down();
+					}
+				);
+			}
+
+			function(std::size_t{0}, std::ranges::min(chunk_size, count));
+			remaining.wait();
+		}
+	};
+}
@@ -0,0 +1,55 @@
+#include <utility/write_file.hpp>
+
+#include <fstream>
+
+namespace utility
+{
+	auto write_file(const std::filesystem::path& path, const write_function_type& write) noexcept -> bool
+	{
+		auto temporary = path;
+		temporary += ".tmp";
+
+		const auto written = [&]() noexcept -> bool
+		{
+			std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+			if (not file.is_open())
+			{
+				return false;
+			}
+
+			if (not write(file))
+			{
+				return false;
+			}
+
+			file.close();
+			return not file.fail();
+		}();
+
+		std::error_code error_code;
+		if (written)
+		{
+			std::filesystem::rename(temporary, path, error_code);
+			if (not error_code)
+			{
+				return true;
+			}
+		}
+
+		std::filesystem::remove(temporary, error_code);
+		return false;
+	}
+
+	auto write_file(const std::filesystem::path& path, const std::span<const std::byte> bytes) noexcept -> bool
+	{
+		return write_file(
+			path,
+			[bytes](std::ostream& out) noexcept -> bool
+			{
+				out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+				return not out.fail();
+			}
+		);
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <span>
+
+namespace utility
+{
+	// 写入文件内容,返回是否成功
+	using write_function_type = std::function<auto(std::ostream& out) -> bool>;
+
+	// 先写入临时文件(path.tmp)再替换,避免中途失败留下不完整的文件(或正在映射旧文件的进程读到不完整的数据)
+	// 失败时删除临时文件
+	[[nodiscard]] auto write_file(const std::filesystem::path& path, const write_function_type& write) noexcept -> bool;
+
+	[[nodiscard]] auto write_file(const std::filesystem::path& path, std::span<const std::byte> bytes) noexcept -> bool;
+}
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <graphics/atlas.hpp>
+#include <graphics/skyline_packer.hpp>
+
+#include <entt/core/hashed_string.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+namespace
+{
+	// 纹理之间的间隔(避免采样到相邻纹理)
+	constexpr std::uint32_t padding = 2;
+
+	constexpr std::uint32_t default_page_size = 2048;
+
+	class Source
+	{
+	public:
+		std::string name;
+		sf::Image image;
+
+		// 过大的纹理不放入图集
+		bool packed;
+		std::size_t page;
+		sf::Vector2u position;
+	};
+
+	// 载入目录中的所有png
+	auto load(const std::filesystem::path& directory, std::vector<Source>& sources) noexcept -> bool
+	{
+		std::error_code error_code;
+		if (not std::filesystem::exists(directory, error_code))
+		{
+			return true;
+		}
+
+		for (const auto& entry: std::filesystem::directory_iterator{directory, error_code})
+		{
+			if (not entry.is_regular_file(error_code) or entry.path().extension() != ".png")
+			{
+				continue;
+			}
+
+			sf::Image image{};
+			if (not image.loadFromFile(entry.path()))
+			{
+				std::println(stderr, "无法载入纹理: {}", entry.path().string());
+				return false;
+			}
+
+			sources.emplace_back(entry.path().stem().string(), std::move(image), false, 0, sf::Vector2u{});
+		}
+
+		return not error_code;
+	}
+}
+
+// 将敌人/塔纹理合并为若干纹理图集
+// td_atlas <media_directory> <output_directory> [page_size]
+auto main(const int argc, char* argv[]) noexcept -> int
+{
+	if (argc != 3 and argc != 4)
+	{
+		std::println(stderr, "用法: td_atlas <media_directory> <output_directory> [page_size]");
+		return 1;
+	}
+
+	const std::filesystem::path media{argv[1]};
+	const std::filesystem::path output{argv[2]};
+
+	auto page_size = default_page_size;
+	if (argc == 4)
+	{
+		const std::string_view argument{argv[3]};
+		if (const auto [ptr, ec] = std::from_chars(argument.data(), argument.data() + argument.size(), page_size);
+			ec != std::errc{} or page_size <= padding)
+		{
+			std::println(stderr, "无效的页大小: {}", argument);
+			return 1;
+		}
+	}
+
+	std::vector<Source> sources;
+	if (not load(media / "enemy", sources) or not load(media / "tower", sources))
+	{
+		return 1;
+	}
+
+	// 先放置较高(较宽)的纹理
+	std::ranges::sort(
+		sources,
+		[](const Source& lhs, const Source& rhs) noexcept -> bool
+		{
+			const auto l = lhs.image.getSize();
+			const auto r = rhs.image.getSize();
+
+			if (l.y != r.y)
+			{
+				return l.y > r.y;
+			}
+			if (l.x != r.x)
+			{
+				return l.x > r.x;
+			}
+			return lhs.name < rhs.name;
+		}
+	);
+
+	std::vector<graphics::SkylinePacker> packers;
+	// 每页实际使用的大小
+	std::vector<sf::Vector2u> extents;
+
+	std::vector<graphics::Atlas::Entry> entries;
+	entries.reserve(sources.size());
+
+	for (auto& source: sources)
+	{
+		const auto size = source.image.getSize();
+		const sf::Vector2u padded_size{size.x + padding, size.y + padding};
+
+		// 依次尝试已有的页,都放不下时新建一页
+		auto page = packers.size();
+		std::optional<sf::Vector2u> position;
+		for (std::size_t i = 0; i < packers.size() and not position.has_value(); ++i)
+		{
+			position = packers[i].insert(padded_size);
+			page = i;
+		}
+
+		if (not position.has_value())
+		{
+			page = packers.size();
+			position = packers.emplace_back(sf::Vector2u{page_size, page_size}).insert(padded_size);
+			extents.emplace_back(0, 0);
+		}
+
+		// 比一页还大,保持为单独的纹理
+		if (not position.has_value())
+		{
+			std::println(stderr, "纹理过大,跳过: {} ({}x{})", source.name, size.x, size.y);
+
+			packers.pop_back();
+			extents.pop_back();
+			continue;
+		}
+
+		source.packed = true;
+		source.page = page;
+		source.position = *position;
+
+		extents[page].x = std::ranges::max(extents[page].x, position->x + size.x);
+		extents[page].y = std::ranges::max(extents[page].y, position->y + size.y);
+
+		entries.push_back(
+			{
+					.texture = entt::hashed_string::value(source.name.data(), source.name.size()),
+					.page = graphics::Atlas::page_id(page),
+					.x = static_cast<std::int32_t>(position->x),
+					.y = static_cast<std::int32_t>(position->y),
+					.width = size.x,
+					.height = size.y,
+			}
+		);
+	}
+
+	std::error_code error_code;
+	std::filesystem::create_directories(output, error_code);
+
+	std::vector<graphics::Atlas::Page> pages;
+	pages.reserve(packers.size());
+
+	for (std::size_t i = 0; i < packers.size(); ++i)
+	{
+		// 裁剪到实际使用的大小
+		sf::Image image{extents[i], sf::Color::Transparent};
+
+		for (const auto& source: sources)
+		{
+			if (not source.packed or source.page != i)
+			{
+				continue;
+			}
+
+			if (not image.copy(source.image, source.position))
+			{
+				std::println(stderr, "无法复制纹理: {}", source.name);
+				return 1;
+			}
+		}
+
+		const auto path = output / (graphics::Atlas::page_name(i) + ".png");
+		if (not image.saveToFile(path))
+		{
+			std::println(stderr, "无法写入图集页: {}", path.string());
+			return 1;
+		}
+
+		pages.push_back({.id = graphics::Atlas::page_id(i), .width = extents[i].x, .height = extents[i].y, .reserved = 0});
+		std::println("{}: {}x{} ({:.1f}% used)", path.string(), extents[i].x, extents[i].y, packers[i].occupancy() * 100.f);
+	}
+
+	const graphics::Atlas atlas{std::move(pages), std::move(entries)};
+	if (const auto path = output / graphics::Atlas::filename;
+		not atlas.write(path))
+	{
+		std::println(stderr, "无法写入图集查找表: {}", path.string());
+		return 1;
+	}
+
+	std::println("{} textures -> {} pages", atlas.entries().size(), atlas.pages().size());
+	return 0;
+}
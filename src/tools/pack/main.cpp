@@ -0,0 +1,34 @@
+#include <filesystem>
+#include <print>
+
+#include <loaders/pack.hpp>
+
+// 将目录下的所有文件打包
+// td_pack <directory> <output>
+auto main(const int argc, char* argv[]) noexcept -> int
+{
+	if (argc != 3)
+	{
+		std::println(stderr, "用法: td_pack <directory> <output>");
+		return 1;
+	}
+
+	const std::filesystem::path directory{argv[1]};
+	const std::filesystem::path output{argv[2]};
+
+	if (not loaders::Pack::build(directory, output))
+	{
+		std::println(stderr, "无法打包: {} -> {}", directory.string(), output.string());
+		return 1;
+	}
+
+	const auto pack = loaders::Pack::open(output);
+	if (not pack.has_value())
+	{
+		std::println(stderr, "无法打开资源包: {}", output.string());
+		return 1;
+	}
+
+	std::println("{} files -> {} ({} bytes)", pack->entries().size(), output.string(), std::filesystem::file_size(output));
+	return 0;
+}